@@ -1,12 +1,25 @@
 #include <CanApp.h>
+#ifdef DASHCAN_HAVE_PCAN
+#include <CanDriverPcan.h>
+#endif
+#ifdef DASHCAN_HAVE_SOCKETCAN
+#include <CanDriverSocketCan.h>
+#endif
 
 CanApp myApp;
 
 CanApp::CanApp(void) noexcept
 {
     s.deviceConnected = false;
+#ifdef DASHCAN_HAVE_PCAN
+    h.backend = CanDriver::Backend::Pcan;
+#else
+    h.backend = CanDriver::Backend::SocketCan;
+#endif
     h.handle = PCAN_USBBUS1;
     h.bitRate = PCAN_BAUD_500K;
+    h.ifName = "can0";
+    driver = nullptr;
     v.uiUpdateTimer = new QTimer();
 
     v.chart = nullptr;
@@ -24,54 +37,73 @@ CanApp::CanApp(void) noexcept
 
 CanApp::~CanApp(void) noexcept
 {
-    // Nothing to clean up
+    delete driver;
 }
 
 int CanApp::DeviceConnect(void)
 {
-    TPCANStatus status = CAN_Initialize(h.handle, h.bitRate);
-    qDebug() << "🔧 CAN connect:"
-             << "Handle =" << QString("0x%1").arg(h.handle, 0, 16).toUpper()
-             << ", Bitrate =" << QString("0x%1").arg(h.bitRate, 0, 16).toUpper();
+    delete driver;
+    driver = nullptr;
 
-    if (status == PCAN_ERROR_OK)
+    switch (h.backend)
     {
-        qDebug("CAN_Initialize(): %lu", status);
-    } else {
-        qDebug("CAN_Initialize() failed: %lu", status);
+#ifdef DASHCAN_HAVE_PCAN
+    case CanDriver::Backend::Pcan:      driver = new CanDriverPcan(h.handle, h.bitRate); break;
+#endif
+#ifdef DASHCAN_HAVE_SOCKETCAN
+    case CanDriver::Backend::SocketCan: driver = new CanDriverSocketCan(h.ifName); break;
+#endif
+    default:
+        qDebug() << "❌ CAN backend not available in this build";
+        return PCAN_ERROR_NODRIVER;
     }
-    status = CAN_Reset(h.handle);
-    qDebug("CAN_Reset(): %lX", status);
 
-    status = CAN_FilterMessages(h.handle, 0x001, 0x7FF, PCAN_MODE_STANDARD);
-    qDebug("CAN_FilterMessages(): %lX", status);
-    return static_cast<int>(status);
+    return driver->Connect();
 }
 
 int CanApp::DeviceDisconnect(void)
 {
-    TPCANStatus status = CAN_Uninitialize(h.handle);
-    if (status == PCAN_ERROR_OK)
-    {
-        qDebug("CAN_Uninitialize(): %lu", status);
-    } else {
-        qDebug("CAN_Uninitialize() failed: %lu", status);
+    if (!driver)
+        return PCAN_ERROR_INITIALIZE;
+
+    int status = driver->Disconnect();
+    if (status == PCAN_ERROR_OK) {
+        delete driver;
+        driver = nullptr;
     }
-    return static_cast<int>(status);
+    return status;
 }
 
 void CanApp::DeviceBufferReset(void)
 {
-    TPCANStatus status;
-    CAN_Reset(h.handle);
-    {
-        TPCANMsg dummy{};
-        TPCANTimestamp ts{};
-        while (CAN_Read(h.handle, &dummy, &ts) == PCAN_ERROR_OK)
-        {
-            // discard
-        }
-    }
+    if (driver)
+        driver->Reset();
+}
+
+int CanApp::DeviceRead(CanFrame &frame)
+{
+    return driver ? driver->Read(frame) : PCAN_ERROR_INITIALIZE;
+}
+
+int CanApp::DeviceReadBatch(CanFrame *frames, int capacity, int &count)
+{
+    count = 0;
+    return driver ? driver->ReadBatch(frames, capacity, count) : PCAN_ERROR_INITIALIZE;
+}
+
+int CanApp::DeviceWaitForReceive(int timeoutMs)
+{
+    return driver ? driver->WaitForReceive(timeoutMs) : PCAN_ERROR_INITIALIZE;
+}
+
+int CanApp::DeviceWrite(const CanFrame &frame)
+{
+    return driver ? driver->Write(frame) : PCAN_ERROR_INITIALIZE;
+}
+
+int CanApp::DeviceGetStatus(void)
+{
+    return driver ? driver->GetStatus() : PCAN_ERROR_INITIALIZE;
 }
 
 void CanApp::DeviceSetConfiguration(TPCANHandle handle, TPCANBaudrate bitrate)
@@ -83,6 +115,15 @@ void CanApp::DeviceSetConfiguration(TPCANHandle handle, TPCANBaudrate bitrate)
              << ", Bitrate =" << QString("0x%1").arg(bitrate, 0, 16).toUpper();
 }
 
+void CanApp::DeviceSetBackend(CanDriver::Backend backend, const QString &ifName)
+{
+    h.backend = backend;
+    h.ifName = ifName;
+    qDebug() << "🔧 CAN Backend updated:"
+             << (backend == CanDriver::Backend::SocketCan ? "SocketCAN" : "PCAN")
+             << ", Interface =" << ifName;
+}
+
 QString CanApp::DeviceGetErrorDescription(uint32_t errorCode)
 {
     switch (errorCode)
@@ -5,9 +5,9 @@
 #include <stdbool.h>
 #include <unistd.h>
 
-#include <windows.h>
-#include <PCANBasic.h>
+#include <CanDriver.h>
 #include <CanDbc.h>
+#include <CanUiSnapshot.h>
 
 #include <QMenu>
 #include <QDebug>
@@ -23,10 +23,12 @@
 #include <QFileDialog>
 #include <QtConcurrent>
 #include <QDateTime>
+#include <QElapsedTimer>
 #include <QTextStream>
 #include <QDir>
 #include <QStandardPaths>
 #include <QList>
+#include <QHash>
 #include <QRegularExpression>
 #include <QMutex>
 #include <QMutexLocker>
@@ -44,6 +46,7 @@
 #include <QTimer>
 #include <QStandardItemModel>
 #include <QStandardItem>
+#include <QTreeWidgetItem>
 #include <QSpinBox>
 #include <QFormLayout>
 #include <QRegularExpression>
@@ -51,13 +54,6 @@
 #include <qlistwidget.h>
 #include <qmenubar.h>
 
-struct CANMessageData {
-    TPCANMsg msg;
-    TPCANTimestamp ts;
-    QList<QPair<QString, double>> decodedSignals;
-    qint64 timestampInMs;
-};
-
 struct TraceFileData {
     int traceMsgCounter;
     double traceTimeMs;
@@ -74,10 +70,14 @@ public:
 
     struct
     {
+        CanDriver::Backend backend;
         TPCANHandle handle;
         TPCANBaudrate bitRate;
+        QString ifName;
     } h;
 
+    CanDriver *driver;
+
     struct
     {
         QString dbcFilePath;
@@ -102,19 +102,24 @@ public:
         QList<QWidget*> signalContainers;
         QMap<QString, QWidget*> signalWidgetMap;
 
-        QMap<QString, QVector<QPointF>> bufferedPoints;
+        // Live stores indexed by CanDBC signal handle, rebuilt from the
+        // name-keyed maps above by MainWindow::bindSignalHandles()
+        QVector<QLineSeries*> seriesByHandle;           // nullptr = not plotted
+        QVector<QWidget*> signalWidgetByHandle;         // nullptr = no panel widget
+        QVector<QTreeWidgetItem*> liveDataSignalItems;  // nullptr = not in the live-data tree
+        QVector<QTreeWidgetItem*> liveDataMessageItems; // Indexed by CanDBC::msgList() position
+
+        QVector<QVector<QPointF>> bufferedPoints;
         QTimer *chartUpdateTimer;
         QMutex bufferMutex;
         QMutex chartAccessMutex;
-        QMap<QString, double> lastSignalUIValues;
-        QMap<QString, qint64> lastSignalUITimestamps;
+        QVector<double> lastSignalUIValues;             // NaN = never shown
+        QVector<qint64> lastSignalUITimestamps;
         QMutex uiUpdateBufferMutex;
-        QMap<QString, qint64> lastTimestamps;
-        QMap<QString, double> lastSignalValues;
+        QVector<double> lastSignalValues;               // NaN = never shown
 
         //subTabRxTx
         QMap<uint32_t, int> msgIdToRowMap;
-        QMap<uint32_t, qint64> msgIdToLastTimestamp;
         QMap<uint32_t, int> msgIdToCount;
 
         //subTabTrace
@@ -147,7 +152,13 @@ public:
     int DeviceConnect(void);
     int DeviceDisconnect(void);
     void DeviceBufferReset(void);
+    int DeviceRead(CanFrame &frame);
+    int DeviceReadBatch(CanFrame *frames, int capacity, int &count);
+    int DeviceWaitForReceive(int timeoutMs);
+    int DeviceWrite(const CanFrame &frame);
+    int DeviceGetStatus(void);
     void DeviceSetConfiguration(TPCANHandle handle, TPCANBaudrate bitrate);
+    void DeviceSetBackend(CanDriver::Backend backend, const QString &ifName);
     QString DeviceGetErrorDescription(uint32_t errorCode);
 };
 
@@ -0,0 +1,490 @@
+#include <CanDbc.h>
+
+#include <QDebug>
+#include <QElapsedTimer>
+#include <QFile>
+
+#include <string.h>
+
+// Vector's placeholder message for signals that are not sent on the bus
+#define DBC_INDEPENDENT_SIGNALS_MESSAGE "VECTOR__INDEPENDENT_SIG_MSG"
+
+namespace {
+
+// One token, pointing into the mapped file
+struct Token
+{
+    const char *text = nullptr;
+    int length = 0;
+    bool quoted = false;
+
+    bool valid() const { return text != nullptr; }
+    bool isChar(char c) const { return !quoted && length == 1 && text[0] == c; }
+
+    template <int N>
+    bool is(const char (&keyword)[N]) const
+    {
+        return !quoted && length == N - 1 && memcmp(text, keyword, N - 1) == 0;
+    }
+
+    bool matches(const QString &name) const
+    {
+        return name == QLatin1String(text, length);
+    }
+
+    QString toString() const { return QString::fromUtf8(text, length); }
+
+    bool toInt(qint64 &value) const
+    {
+        if (quoted || length == 0)
+            return false;
+        const char *c = text;
+        const char *last = text + length;
+        const bool negative = (*c == '-');
+        if (*c == '-' || *c == '+')
+            ++c;
+        if (c == last)
+            return false;
+        qint64 v = 0;
+        for (; c < last; ++c) {
+            if (*c < '0' || *c > '9')
+                return false;
+            v = v * 10 + (*c - '0');
+        }
+        value = negative ? -v : v;
+        return true;
+    }
+
+    bool toDouble(double &value) const
+    {
+        if (quoted || length == 0)
+            return false;
+        bool ok = false;
+        value = QByteArray::fromRawData(text, length).toDouble(&ok);   // C locale, no copy
+        return ok;
+    }
+};
+
+// Streams tokens out of a DBC buffer without copying it.
+class DbcLexer
+{
+public:
+    DbcLexer(const char *data, qint64 size) : p(data), end(data + size) {}
+
+    /// Next token; an invalid one at end of input, or at end of line when
+    /// sameLine is set. Quoted strings may span lines.
+    Token next(bool sameLine = false)
+    {
+        skipSpace(sameLine);
+        Token t;
+        if (p >= end || (sameLine && *p == '\n'))
+            return t;
+
+        if (*p == '"') {
+            const char *start = ++p;
+            while (p < end && *p != '"') {
+                if (*p == '\\' && p + 1 < end)
+                    ++p;
+                else if (*p == '\n')
+                    ++lineNumber;
+                ++p;
+            }
+            t.text = start;
+            t.length = static_cast<int>(p - start);
+            t.quoted = true;
+            if (p < end)
+                ++p;
+            return t;
+        }
+
+        t.text = p;
+        if (isPunct(*p)) {
+            ++p;
+        } else {
+            while (p < end && !isSpace(*p) && !isPunct(*p) && *p != '"')
+                ++p;
+        }
+        t.length = static_cast<int>(p - t.text);
+        return t;
+    }
+
+    /// Continue after the next line break.
+    void skipLine()
+    {
+        const void *nl = memchr(p, '\n', static_cast<size_t>(end - p));
+        if (nl) {
+            p = static_cast<const char *>(nl) + 1;
+            ++lineNumber;
+        } else {
+            p = end;
+        }
+    }
+
+    /// Continue after the next ';' outside a quoted string.
+    void skipStatement()
+    {
+        for (Token t = next(); t.valid() && !t.isChar(';'); t = next()) {}
+    }
+
+    /// True while the cursor sits on an indented or blank line (NS_ symbol list).
+    bool atIndentedLine() const
+    {
+        return p < end && (*p == ' ' || *p == '\t' || *p == '\r' || *p == '\n');
+    }
+
+    int line() const { return lineNumber; }
+
+private:
+    static bool isSpace(char c) { return c == ' ' || c == '\t' || c == '\r' || c == '\n'; }
+    static bool isPunct(char c)
+    {
+        return c == ':' || c == '|' || c == '@' || c == '(' || c == ')' ||
+               c == ',' || c == '[' || c == ']' || c == ';';
+    }
+
+    void skipSpace(bool sameLine)
+    {
+        while (p < end && isSpace(*p)) {
+            if (*p == '\n') {
+                if (sameLine)
+                    return;
+                ++lineNumber;
+            }
+            ++p;
+        }
+    }
+
+    const char *p;
+    const char *end;
+    int lineNumber = 1;
+};
+
+// Builds the message list from the statements the decoder cares about
+class DbcParser
+{
+public:
+    DbcParser(DbcLexer &lexer, QList<CanDBC::Message> &messages) : lex(lexer), messages(messages) {}
+
+    void run()
+    {
+        int current = -1;   // Message that SG_ lines attach to
+        for (Token kw = lex.next(); kw.valid(); kw = lex.next()) {
+            bool ok = true;
+            if (kw.is("BO_")) {
+                ok = parseMessage(current);
+            } else if (kw.is("SG_")) {
+                ok = (current < 0) || parseSignal(messages[current]);
+                if (current < 0)
+                    lex.skipLine();     // Signal of a skipped message
+            } else {
+                current = -1;
+                if (kw.is("CM_"))
+                    ok = parseComment();
+                else if (kw.is("BA_"))
+                    ok = parseAttribute();
+                else if (kw.is("VAL_"))
+                    ok = parseValueDescriptions();
+                else if (kw.is("SIG_VALTYPE_"))
+                    ok = parseValueType();
+                else if (kw.is("NS_"))
+                    skipSymbolList();
+                else
+                    lex.skipLine();
+            }
+
+            if (!ok) {
+                qWarning() << "DBC line" << lex.line() << ": cannot parse" << kw.toString() << "statement, skipped";
+                lex.skipLine();
+            }
+        }
+    }
+
+private:
+    bool expect(char c) { return lex.next(true).isChar(c); }
+
+    bool readInt(qint64 &value) { return lex.next(true).toInt(value); }
+    bool readDouble(double &value) { return lex.next(true).toDouble(value); }
+
+    // BO_ <id> <name>: <dlc> <sender>
+    bool parseMessage(int &current)
+    {
+        current = -1;
+        qint64 id = 0, dlc = 0;
+        if (!readInt(id))
+            return false;
+        const Token name = lex.next(true);
+        if (!name.valid() || !expect(':') || !readInt(dlc))
+            return false;
+        const Token sender = lex.next(true);
+
+        if (name.is(DBC_INDEPENDENT_SIGNALS_MESSAGE))
+            return true;
+
+        CanDBC::Message msg;
+        msg.id = static_cast<int>(static_cast<uint32_t>(id));
+        msg.name = name.toString();
+        msg.dlc = static_cast<int>(dlc);
+        if (sender.valid())
+            msg.sender = sender.toString();
+
+        current = messages.size();
+        indexById.insert(static_cast<uint32_t>(msg.id), current);
+        messages.append(msg);
+        return true;
+    }
+
+    // SG_ <name> [M|m<n>[M]] : <start>|<length>@<order><sign> (<scale>,<offset>) [<min>|<max>] "<unit>" <receivers>
+    bool parseSignal(CanDBC::Message &msg)
+    {
+        CanDBC::Signal sig;
+        const Token name = lex.next(true);
+        if (!name.valid())
+            return false;
+        sig.name = name.toString();
+
+        Token t = lex.next(true);
+        if (!t.isChar(':')) {
+            if (t.is("M")) {
+                sig.isMultiplexor = true;
+            } else if (t.length >= 2 && t.text[0] == 'm') {
+                Token value = t;
+                ++value.text;
+                --value.length;
+                if (value.text[value.length - 1] == 'M') {
+                    sig.isMultiplexor = true;   // Extended multiplexing: both selector and selected
+                    --value.length;
+                }
+                qint64 muxValue = 0;
+                if (!value.toInt(muxValue))
+                    return false;
+                sig.muxValue = static_cast<int>(muxValue);
+            } else {
+                return false;
+            }
+            if (!expect(':'))
+                return false;
+        }
+
+        qint64 start = 0, length = 0;
+        if (!readInt(start) || !expect('|') || !readInt(length) || !expect('@'))
+            return false;
+        sig.startBit = static_cast<int>(start);
+        sig.bitLength = static_cast<int>(length);
+
+        const Token format = lex.next(true);
+        if (format.length != 2 || format.quoted)
+            return false;
+        sig.byteOrder = (format.text[0] == '1') ? CanDBC::ByteOrder::LittleEndian : CanDBC::ByteOrder::BigEndian;
+        sig.isSigned = (format.text[1] == '-');
+
+        if (!expect('(') || !readDouble(sig.scale) || !expect(',') || !readDouble(sig.offset) || !expect(')'))
+            return false;
+        if (!expect('[') || !readDouble(sig.minimum) || !expect('|') || !readDouble(sig.maximum) || !expect(']'))
+            return false;
+
+        const Token unit = lex.next(true);
+        if (!unit.quoted)
+            return false;
+        sig.unit = unit.toString();
+
+        for (t = lex.next(true); t.valid(); t = lex.next(true)) {
+            if (t.isChar(','))
+                continue;
+            if (!sig.receiver.isEmpty())
+                sig.receiver += QLatin1Char(',');
+            sig.receiver += t.toString();
+        }
+
+        msg.canSignals.append(sig);
+        return true;
+    }
+
+    CanDBC::Message *findMessage(qint64 id)
+    {
+        const int index = indexById.value(static_cast<uint32_t>(id), -1);
+        return (index >= 0) ? &messages[index] : nullptr;
+    }
+
+    CanDBC::Signal *findSignal(qint64 id, const Token &name)
+    {
+        CanDBC::Message *msg = findMessage(id);
+        if (!msg)
+            return nullptr;
+        for (CanDBC::Signal &sig : msg->canSignals) {
+            if (name.matches(sig.name))
+                return &sig;
+        }
+        return nullptr;
+    }
+
+    // CM_ [BU_ <node> | BO_ <id> | SG_ <id> <signal> | EV_ <name>] "<text>";
+    bool parseComment()
+    {
+        const Token t = lex.next();
+        qint64 id = 0;
+        if (t.is("BO_")) {
+            if (!lex.next().toInt(id))
+                return false;
+            const Token text = lex.next();
+            if (!text.quoted)
+                return false;
+            if (CanDBC::Message *msg = findMessage(id))
+                msg->description = text.toString();
+        } else if (t.is("SG_")) {
+            if (!lex.next().toInt(id))
+                return false;
+            const Token name = lex.next();
+            const Token text = lex.next();
+            if (!text.quoted)
+                return false;
+            if (CanDBC::Signal *sig = findSignal(id, name))
+                sig->comment = text.toString();
+        }
+        // Network, node and environment comments are not used
+        lex.skipStatement();
+        return true;
+    }
+
+    // BA_ "<name>" [BU_ <node> | BO_ <id> | SG_ <id> <signal> | EV_ <name>] <value>;
+    bool parseAttribute()
+    {
+        const Token name = lex.next();
+        if (!name.quoted)
+            return false;
+
+        const Token t = lex.next();
+        qint64 id = 0;
+        if (t.is("BO_")) {
+            if (!lex.next().toInt(id))
+                return false;
+            const Token value = lex.next();
+            if (CanDBC::Message *msg = findMessage(id))
+                msg->attributes.insert(name.toString(), value.toString());
+        } else if (t.is("SG_")) {
+            if (!lex.next().toInt(id))
+                return false;
+            const Token signal = lex.next();
+            const Token value = lex.next();
+            if (CanDBC::Signal *sig = findSignal(id, signal))
+                sig->attributes.insert(name.toString(), value.toString());
+        }
+        // Network, node and environment attributes are not used
+        if (!t.isChar(';'))
+            lex.skipStatement();
+        return true;
+    }
+
+    // VAL_ <id> <signal> <value> "<text>" ... ;
+    bool parseValueDescriptions()
+    {
+        qint64 id = 0;
+        if (!lex.next().toInt(id)) {
+            lex.skipStatement();    // Environment variable table
+            return true;
+        }
+        CanDBC::Signal *sig = findSignal(id, lex.next());
+
+        for (Token t = lex.next(); !t.isChar(';'); t = lex.next()) {
+            qint64 value = 0;
+            const Token text = lex.next();
+            if (!t.toInt(value) || !text.quoted)
+                return false;
+            if (sig)
+                sig->valueDescriptions.insert(value, text.toString());
+        }
+        return true;
+    }
+
+    // SIG_VALTYPE_ <id> <signal> : <1|2>;
+    bool parseValueType()
+    {
+        qint64 id = 0, type = 0;
+        if (!lex.next().toInt(id))
+            return false;
+        CanDBC::Signal *sig = findSignal(id, lex.next());
+        Token t = lex.next();
+        if (t.isChar(':'))
+            t = lex.next();
+        if (!t.toInt(type))
+            return false;
+        if (sig)
+            sig->valueType = (type == 1) ? CanDBC::ValueType::Float
+                           : (type == 2) ? CanDBC::ValueType::Double
+                                         : CanDBC::ValueType::Integer;
+        lex.skipStatement();
+        return true;
+    }
+
+    // NS_ : followed by one indented keyword per line
+    void skipSymbolList()
+    {
+        lex.skipLine();
+        while (lex.atIndentedLine())
+            lex.skipLine();
+    }
+
+    DbcLexer &lex;
+    QList<CanDBC::Message> &messages;
+    QHash<uint32_t, int> indexById;
+};
+
+} // namespace
+
+CanDBC::CanDBC()
+{
+}
+
+CanDBC::~CanDBC()
+{
+}
+
+bool CanDBC::loadDBC(const QString &dbcFilePath)
+{
+    QElapsedTimer timer;
+    timer.start();
+    clear();
+
+    QFile file(dbcFilePath);
+    if (!file.open(QIODevice::ReadOnly)) {
+        qWarning() << "❌ Cannot open DBC file:" << dbcFilePath << file.errorString();
+        return false;
+    }
+
+    // Tokens point straight into the mapping; only the names and texts kept
+    // in the definitions are copied out
+    QByteArray fallback;
+    const char *data = nullptr;
+    qint64 size = file.size();
+    if (size > 0) {
+        if (uchar *mapped = file.map(0, size)) {
+            data = reinterpret_cast<const char *>(mapped);
+        } else {
+            fallback = file.readAll();
+            data = fallback.constData();
+            size = fallback.size();
+        }
+    }
+
+    if (!data || !parse(data, size)) {
+        qWarning() << "❌ No messages found in DBC file:" << dbcFilePath;
+        clear();
+        return false;
+    }
+
+    compile();
+    qDebug() << "📂 DBC loaded:" << messages.size() << "messages," << signalPlans.size()
+             << "signals in" << timer.elapsed() << "ms";
+    return true;
+}
+
+bool CanDBC::parse(const char *data, qint64 size)
+{
+    DbcLexer lexer(data, size);
+    DbcParser(lexer, messages).run();
+    return !messages.isEmpty();
+}
+
+const QList<CanDBC::Message> &CanDBC::msgList() const
+{
+    return messages;
+}
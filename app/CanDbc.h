@@ -1,11 +1,29 @@
 #pragma once
 
+#include <CanFrame.h>
+
 #include <QString>
 #include <QStringList>
 #include <QList>
 #include <QPair>
 #include <QByteArray>
+#include <QHash>
+#include <QMap>
+#include <QVector>
+
+#include <stdint.h>
+
+/// Payload bytes the decoder can address, plus room for an 8-byte load at the end.
+#define CAN_DBC_PLAN_MAX_PAYLOAD    64
+#define CAN_DBC_PLAN_PADDED_BYTES   (CAN_DBC_PLAN_MAX_PAYLOAD + 8)
+
+/// Size of the direct-mapped table covering every 11-bit identifier.
+#define CAN_DBC_PLAN_STANDARD_IDS   0x800
 
+/// DBC database: parsed definitions plus the flat extraction plan compiled
+/// from them. Every signal is reduced to "load 64 bits at a byte offset,
+/// shift, mask, sign-extend, scale + offset", so decoding a frame is one loop
+/// over a contiguous array with no per-signal layout logic.
 class CanDBC
 {
 public:
@@ -14,6 +32,13 @@ public:
         BigEndian
     };
 
+    /// Raw value encoding, from SIG_VALTYPE_.
+    enum class ValueType {
+        Integer,
+        Float,      // IEEE 754 single, 32-bit field
+        Double      // IEEE 754 double, 64-bit field
+    };
+
     struct Signal {
         QString   name;
         int       startBit;
@@ -23,30 +48,133 @@ public:
         double    scale;
         double    offset;
         QString   unit;
-        QString   receiver;
+        QString   receiver;                         // Receiving nodes, comma separated
+        double    minimum = 0.0;
+        double    maximum = 0.0;
+        ValueType valueType = ValueType::Integer;
+        bool      isMultiplexor = false;            // "M": selects the multiplexed signals
+        int       muxValue = -1;                    // "m<n>": only present when the multiplexor reads n, -1 = always
+        QString   comment;                          // CM_ SG_
+        QMap<qint64, QString> valueDescriptions;    // VAL_
+        QHash<QString, QString> attributes;         // BA_ SG_
     };
 
     struct Message {
-        int           id;
+        int           id;                           // Bit 31 set for 29-bit identifiers
         QString       name;
-        QString       description;
+        QString       description;                  // CM_ BO_
         QString       sender;
         QList<Signal> canSignals;
+        int           dlc = 0;
+        QHash<QString, QString> attributes;         // BA_ BO_
+    };
+
+    struct SignalPlan {
+        uint64_t mask;          // (1 << bitLength) - 1
+        uint64_t signBit;       // Top bit of the field for signed signals, 0 otherwise
+        double   scale;
+        double   offset;
+        uint8_t  byteOffset;    // First byte of the 64-bit load window
+        uint8_t  shift;         // Right shift that moves the field's LSB to bit 0
+        uint8_t  bigEndian;     // Motorola: load the window big-endian
+        uint8_t  minLength;     // Payload bytes the signal needs
+        uint8_t  valueType;     // ValueType; non-integer fields are reinterpreted, not converted
+    };
+
+    struct MessagePlan {
+        int id;
+        int firstSignal;        // Index into the flat signal arrays
+        int signalCount;
+    };
+
+    /// One decoded value; index is the signal handle.
+    struct DecodedSignal {
+        int    index;
+        double value;
+    };
+
+    /// Position of a signal definition in msgList().
+    struct SignalRef {
+        int message;            // Index into msgList()
+        int signal;             // Index into Message::canSignals
+        int handle;             // Dense signal handle, see signalHandle()
     };
 
     CanDBC();
     ~CanDBC();
 
-    /// Load and parse the DBC file. Returns false on error.
+    /// Load and parse the DBC file, then compile the extraction plan.
+    /// Every signal gets a dense handle in [0, signalCount()), in msgList()
+    /// order, which stays valid until the next load. Returns false on error.
     bool loadDBC(const QString &dbcFilePath);
 
+    /// Drop all definitions and plans.
+    void clear();
+
     /// Returns the list of parsed messages (in the order they appeared).
     const QList<Message>& msgList() const;
 
-    /// Given a raw CAN frame (id + 0–8 bytes), decode to (signalName, value).
+    /// Given a raw CAN frame (id + payload), decode to (signalName, value).
     QList<QPair<QString,double>> decodeFrame(int messageId, const QByteArray &rawData) const;
 
+    /// Decode into a caller-supplied array without touching the heap.
+    /// Returns the number of values written (at most capacity).
+    int decodeFrame(uint32_t messageId, const uint8_t *data, int length, DecodedSignal *out, int capacity) const;
+
+    /// Decode frameCount frames that all carry messageId, one signal at a time
+    /// across the whole batch (SSE2/AVX2 where the CPU has it). Values land in
+    /// column layout: columns[s * frameCount + n] is handle firstSignal + s of
+    /// frame n, NaN where the frame is too short for the signal. Frame IDs are
+    /// not checked. Returns the column count, or 0 if the ID is unknown or
+    /// capacity is below columns * frameCount.
+    int decodeBatch(uint32_t messageId, const CanFrame *frames, int frameCount, double *columns, int capacity) const;
+
+    /// Plan of messageId, or nullptr if the DBC does not define it. O(1).
+    const MessagePlan *findMessage(int messageId) const;
+
+    /// Index of messageId in msgList(), or -1. O(1).
+    int messageIndex(int messageId) const;
+
+    /// Index of the message called name in msgList(), or -1.
+    int messageIndex(const QString &name) const;
+
+    /// Where the signal called name is defined, or nullptr.
+    const SignalRef *findSignal(const QString &name) const;
+
+    /// Handle of the signal called name, or -1. The first definition wins on duplicates.
+    int signalHandle(const QString &name) const;
+
+    /// Definitions by ID / name (nullptr if unknown).
+    const Message *messageDef(int messageId) const;
+    const Signal *signalDef(const QString &name) const;
+
+    int messageCount() const { return messagePlans.size(); }
+    int signalCount() const { return signalPlans.size(); }
+    int maxSignalsPerMessage() const { return maxMessageSignals; }
+    const QString &signalName(int handle) const { return signalNames[handle]; }
+
+    /// Extract one signal from a payload padded to CAN_DBC_PLAN_PADDED_BYTES.
+    static double extract(const SignalPlan &plan, const uint8_t *padded);
+
 private:
-    struct Impl;
-    Impl *d;
+    bool parse(const char *data, qint64 size);
+    bool compile();
+    void insertExtended(uint32_t id, int index);
+    int lookupExtended(uint32_t id) const;
+
+    QList<Message> messages;
+
+    QVector<MessagePlan> messagePlans;  // Same order as messages
+    QVector<SignalPlan> signalPlans;
+    QVector<QString> signalNames;
+    int maxMessageSignals = 0;
+
+    // CAN ID -> index into messages
+    QVector<int> standardIndex;         // Direct-mapped, CAN_DBC_PLAN_STANDARD_IDS entries, -1 = none
+    QVector<uint32_t> extendedKeys;     // Open addressing, linear probing, power-of-two size
+    QVector<int> extendedValues;
+    uint32_t extendedMask = 0;
+
+    QHash<QString, int> messageByName;
+    QHash<QString, SignalRef> signalByName;
 };
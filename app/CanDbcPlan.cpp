@@ -0,0 +1,278 @@
+#include <CanDbc.h>
+
+#include <QDebug>
+#include <QVarLengthArray>
+#include <QtEndian>
+
+#include <string.h>
+
+// Marks a free slot in the extended-ID hash (not a valid 29-bit identifier)
+#define EXTENDED_SLOT_EMPTY     0xFFFFFFFFu
+
+namespace {
+
+inline uint32_t hashId(uint32_t id)
+{
+    // Fibonacci hashing spreads the clustered IDs of a DBC across the table
+    return id * 0x9E3779B1u;
+}
+
+// Lay a signal out as a 64-bit window load. Returns false if the field does
+// not fit in one window (only possible for >57-bit signals off a byte boundary).
+bool compileSignal(const CanDBC::Signal &sig, CanDBC::SignalPlan &plan)
+{
+    // IEEE fields are loaded like any other field and reinterpreted in extract()
+    plan.valueType = static_cast<uint8_t>(sig.valueType);
+    if ((sig.valueType == CanDBC::ValueType::Float && sig.bitLength != 32) ||
+        (sig.valueType == CanDBC::ValueType::Double && sig.bitLength != 64))
+        return false;
+
+    const int len = sig.bitLength;
+    const int start = sig.startBit;
+    if (len <= 0 || len > 64 || start < 0 || start >= CAN_DBC_PLAN_MAX_PAYLOAD * 8)
+        return false;
+
+    int lastByte;
+    if (sig.byteOrder == CanDBC::ByteOrder::LittleEndian) {
+        // Intel: start bit is the LSB, counting up through the payload
+        const int bitInWindow = start % 8;
+        if (bitInWindow + len > 64)
+            return false;
+        plan.byteOffset = static_cast<uint8_t>(start / 8);
+        plan.shift = static_cast<uint8_t>(bitInWindow);
+        plan.bigEndian = 0;
+        lastByte = (start + len - 1) / 8;
+    } else {
+        // Motorola: start bit is the MSB in sawtooth numbering; the window is
+        // read big-endian from the MSB's byte so the field is contiguous
+        const int msbFromTop = 7 - (start % 8);
+        if (msbFromTop + len > 64)
+            return false;
+        plan.byteOffset = static_cast<uint8_t>(start / 8);
+        plan.shift = static_cast<uint8_t>(64 - msbFromTop - len);
+        plan.bigEndian = 1;
+        lastByte = start / 8 + (msbFromTop + len - 1) / 8;
+    }
+    if (lastByte >= CAN_DBC_PLAN_MAX_PAYLOAD)
+        return false;
+
+    plan.mask = (len == 64) ? ~0ULL : ((1ULL << len) - 1);
+    plan.signBit = sig.isSigned ? (1ULL << (len - 1)) : 0;
+    plan.scale = sig.scale;
+    plan.offset = sig.offset;
+    plan.minLength = static_cast<uint8_t>(lastByte + 1);
+    return true;
+}
+
+} // namespace
+
+bool CanDBC::compile()
+{
+    standardIndex.fill(-1, CAN_DBC_PLAN_STANDARD_IDS);
+
+    uint32_t extendedSize = 16;
+    while (extendedSize < static_cast<uint32_t>(messages.size()) * 2)
+        extendedSize <<= 1;
+    extendedKeys.fill(EXTENDED_SLOT_EMPTY, static_cast<int>(extendedSize));
+    extendedValues.fill(-1, static_cast<int>(extendedSize));
+    extendedMask = extendedSize - 1;
+
+    int skipped = 0;
+    for (int mi = 0; mi < messages.size(); ++mi) {
+        const Message &msg = messages[mi];
+        MessagePlan mp;
+        mp.id = msg.id;
+        mp.firstSignal = signalPlans.size();
+        mp.signalCount = 0;
+
+        for (int si = 0; si < msg.canSignals.size(); ++si) {
+            const Signal &sig = msg.canSignals[si];
+            if (!signalByName.contains(sig.name))
+                signalByName.insert(sig.name, SignalRef{mi, si, static_cast<int>(signalPlans.size())});
+
+            SignalPlan sp;
+            if (!compileSignal(sig, sp)) {
+                // Keep the handle so the UI can still refer to it; it just never decodes
+                qWarning() << "DBC plan: unsupported layout for" << msg.name << "/" << sig.name;
+                sp = SignalPlan();
+                sp.minLength = 0xFF;
+                ++skipped;
+            }
+            signalPlans.append(sp);
+            signalNames.append(sig.name);
+            ++mp.signalCount;
+        }
+
+        // DBC files flag extended IDs with bit 31
+        const uint32_t rawId = static_cast<uint32_t>(msg.id);
+        const uint32_t canId = rawId & 0x1FFFFFFFu;
+        if (!(rawId & 0x80000000u) && canId < CAN_DBC_PLAN_STANDARD_IDS)
+            standardIndex[static_cast<int>(canId)] = mi;
+        else
+            insertExtended(canId, mi);
+
+        if (!messageByName.contains(msg.name))
+            messageByName.insert(msg.name, mi);
+        maxMessageSignals = qMax(maxMessageSignals, mp.signalCount);
+        messagePlans.append(mp);
+    }
+
+    qDebug() << "DBC plan compiled:" << messagePlans.size() << "messages," << signalPlans.size()
+             << "signals," << skipped << "skipped";
+    return !messagePlans.isEmpty();
+}
+
+void CanDBC::clear()
+{
+    messages.clear();
+    maxMessageSignals = 0;
+    messagePlans.clear();
+    signalPlans.clear();
+    signalNames.clear();
+    standardIndex.clear();
+    extendedKeys.clear();
+    extendedValues.clear();
+    extendedMask = 0;
+    messageByName.clear();
+    signalByName.clear();
+}
+
+void CanDBC::insertExtended(uint32_t id, int index)
+{
+    uint32_t slot = hashId(id) & extendedMask;
+    while (extendedKeys[static_cast<int>(slot)] != EXTENDED_SLOT_EMPTY) {
+        if (extendedKeys[static_cast<int>(slot)] == id)
+            return;     // First definition wins
+        slot = (slot + 1) & extendedMask;
+    }
+    extendedKeys[static_cast<int>(slot)] = id;
+    extendedValues[static_cast<int>(slot)] = index;
+}
+
+int CanDBC::lookupExtended(uint32_t id) const
+{
+    if (extendedKeys.isEmpty())
+        return -1;
+
+    const uint32_t *keys = extendedKeys.constData();
+    uint32_t slot = hashId(id) & extendedMask;
+    while (keys[slot] != EXTENDED_SLOT_EMPTY) {
+        if (keys[slot] == id)
+            return extendedValues[static_cast<int>(slot)];
+        slot = (slot + 1) & extendedMask;
+    }
+    return -1;
+}
+
+int CanDBC::messageIndex(int messageId) const
+{
+    const uint32_t id = static_cast<uint32_t>(messageId) & 0x1FFFFFFFu;
+    if (id < CAN_DBC_PLAN_STANDARD_IDS && !standardIndex.isEmpty()) {
+        const int index = standardIndex[static_cast<int>(id)];
+        if (index >= 0)
+            return index;
+    }
+    return lookupExtended(id);
+}
+
+int CanDBC::messageIndex(const QString &name) const
+{
+    return messageByName.value(name, -1);
+}
+
+const CanDBC::MessagePlan *CanDBC::findMessage(int messageId) const
+{
+    const int index = messageIndex(messageId);
+    return (index >= 0) ? &messagePlans[index] : nullptr;
+}
+
+const CanDBC::SignalRef *CanDBC::findSignal(const QString &name) const
+{
+    auto it = signalByName.constFind(name);
+    return (it != signalByName.constEnd()) ? &it.value() : nullptr;
+}
+
+int CanDBC::signalHandle(const QString &name) const
+{
+    const SignalRef *ref = findSignal(name);
+    return ref ? ref->handle : -1;
+}
+
+const CanDBC::Message *CanDBC::messageDef(int messageId) const
+{
+    const int index = messageIndex(messageId);
+    return (index >= 0) ? &messages[index] : nullptr;
+}
+
+const CanDBC::Signal *CanDBC::signalDef(const QString &name) const
+{
+    const SignalRef *ref = findSignal(name);
+    return ref ? &messages[ref->message].canSignals[ref->signal] : nullptr;
+}
+
+double CanDBC::extract(const SignalPlan &plan, const uint8_t *padded)
+{
+    const uint8_t *window = padded + plan.byteOffset;
+    const uint64_t word = plan.bigEndian ? qFromBigEndian<quint64>(window)
+                                         : qFromLittleEndian<quint64>(window);
+    const uint64_t raw = (word >> plan.shift) & plan.mask;
+
+    if (Q_UNLIKELY(plan.valueType != static_cast<uint8_t>(ValueType::Integer))) {
+        if (plan.valueType == static_cast<uint8_t>(ValueType::Float)) {
+            const uint32_t bits = static_cast<uint32_t>(raw);
+            float f;
+            memcpy(&f, &bits, sizeof(f));
+            return static_cast<double>(f) * plan.scale + plan.offset;
+        }
+        double d;
+        memcpy(&d, &raw, sizeof(d));
+        return d * plan.scale + plan.offset;
+    }
+
+    // Two's complement sign extension without a branch on the field width
+    const double value = plan.signBit ? static_cast<double>(static_cast<int64_t>((raw ^ plan.signBit) - plan.signBit))
+                                      : static_cast<double>(raw);
+    return value * plan.scale + plan.offset;
+}
+
+QList<QPair<QString,double>> CanDBC::decodeFrame(int messageId, const QByteArray &rawData) const
+{
+    QList<QPair<QString,double>> result;
+    const MessagePlan *mp = findMessage(messageId);
+    if (!mp || mp->signalCount == 0)
+        return result;
+
+    QVarLengthArray<DecodedSignal, 64> decoded(mp->signalCount);
+    const int count = decodeFrame(static_cast<uint32_t>(messageId),
+                                  reinterpret_cast<const uint8_t *>(rawData.constData()),
+                                  static_cast<int>(rawData.size()), decoded.data(), static_cast<int>(decoded.size()));
+
+    result.reserve(count);
+    for (int i = 0; i < count; ++i)
+        result.append(qMakePair(signalNames[decoded[i].index], decoded[i].value));
+    return result;
+}
+
+int CanDBC::decodeFrame(uint32_t messageId, const uint8_t *data, int length, DecodedSignal *out, int capacity) const
+{
+    const MessagePlan *mp = findMessage(static_cast<int>(messageId));
+    if (!mp)
+        return 0;
+
+    // Zero-padded copy on the stack so every 64-bit window load stays in bounds
+    uint8_t padded[CAN_DBC_PLAN_PADDED_BYTES];
+    const int len = qBound(0, length, CAN_DBC_PLAN_MAX_PAYLOAD);
+    memcpy(padded, data, static_cast<size_t>(len));
+    memset(padded + len, 0, sizeof(padded) - static_cast<size_t>(len));
+
+    int count = 0;
+    const SignalPlan *plans = signalPlans.constData() + mp->firstSignal;
+    for (int i = 0; i < mp->signalCount && count < capacity; ++i) {
+        if (plans[i].minLength > len)
+            continue;
+        out[count].index = mp->firstSignal + i;
+        out[count].value = extract(plans[i], padded);
+        ++count;
+    }
+    return count;
+}
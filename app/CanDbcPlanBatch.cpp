@@ -0,0 +1,173 @@
+#include <CanDbc.h>
+
+#include <QtEndian>
+
+#include <algorithm>
+#include <limits>
+#include <string.h>
+
+// Vector paths are x86-64 only: SSE2 is always there, AVX2/FMA is picked at run time
+#if defined(__GNUC__) && defined(__x86_64__)
+#include <immintrin.h>
+#define CAN_DBC_BATCH_X86
+#endif
+
+// Frames staged per pass, small enough for the padded copies to stay on the stack
+#define CAN_DBC_BATCH_CHUNK         64
+
+// Widest field the vector paths convert to double exactly (52-bit mantissa trick)
+#define CAN_DBC_BATCH_VECTOR_BITS   52
+
+namespace {
+
+typedef uint8_t PaddedPayload[CAN_DBC_PLAN_PADDED_BYTES];
+
+void extractScalar(const CanDBC::SignalPlan &plan, const PaddedPayload *payloads, int count, double *out)
+{
+    for (int n = 0; n < count; ++n)
+        out[n] = CanDBC::extract(plan, payloads[n]);
+}
+
+#ifdef CAN_DBC_BATCH_X86
+
+// Bit patterns of 2^52 and 2^52 + 2^51. Adding a small integer to them as an
+// integer and subtracting them as a double converts it without cvtepi64_pd.
+const long long kUnsignedMagic = 0x4330000000000000LL;
+const long long kSignedMagic   = 0x4338000000000000LL;
+
+inline uint64_t loadWindow(const CanDBC::SignalPlan &plan, const uint8_t *padded)
+{
+    const uint8_t *window = padded + plan.byteOffset;
+    return plan.bigEndian ? qFromBigEndian<quint64>(window) : qFromLittleEndian<quint64>(window);
+}
+
+// Two frames per step; the window loads stay scalar since SSE2 has no gather or byte shuffle
+void extractSse2(const CanDBC::SignalPlan &plan, const PaddedPayload *payloads, int count, double *out)
+{
+    const __m128i shift   = _mm_cvtsi32_si128(plan.shift);
+    const __m128i mask    = _mm_set1_epi64x(static_cast<long long>(plan.mask));
+    const __m128i signBit = _mm_set1_epi64x(static_cast<long long>(plan.signBit));
+    const __m128i magic   = _mm_set1_epi64x(plan.signBit ? kSignedMagic : kUnsignedMagic);
+    const __m128d magicPd = _mm_castsi128_pd(magic);
+    const __m128d scale   = _mm_set1_pd(plan.scale);
+    const __m128d offset  = _mm_set1_pd(plan.offset);
+
+    int n = 0;
+    for (; n + 2 <= count; n += 2) {
+        __m128i raw = _mm_set_epi64x(static_cast<long long>(loadWindow(plan, payloads[n + 1])),
+                                     static_cast<long long>(loadWindow(plan, payloads[n])));
+        raw = _mm_and_si128(_mm_srl_epi64(raw, shift), mask);
+        raw = _mm_sub_epi64(_mm_xor_si128(raw, signBit), signBit);
+        const __m128d value = _mm_sub_pd(_mm_castsi128_pd(_mm_add_epi64(raw, magic)), magicPd);
+        _mm_storeu_pd(out + n, _mm_add_pd(_mm_mul_pd(value, scale), offset));
+    }
+    extractScalar(plan, payloads + n, count - n, out + n);
+}
+
+// Four frames per step: gather the windows, byte-swap Motorola lanes, fused scale + offset
+__attribute__((target("avx2,fma")))
+void extractAvx2(const CanDBC::SignalPlan &plan, const PaddedPayload *payloads, int count, double *out)
+{
+    const __m128i shift   = _mm_cvtsi32_si128(plan.shift);
+    const __m256i mask    = _mm256_set1_epi64x(static_cast<long long>(plan.mask));
+    const __m256i signBit = _mm256_set1_epi64x(static_cast<long long>(plan.signBit));
+    const __m256i magic   = _mm256_set1_epi64x(plan.signBit ? kSignedMagic : kUnsignedMagic);
+    const __m256d magicPd = _mm256_castsi256_pd(magic);
+    const __m256d scale   = _mm256_set1_pd(plan.scale);
+    const __m256d offset  = _mm256_set1_pd(plan.offset);
+    const __m256i swap    = _mm256_setr_epi8(7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8,
+                                             7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8);
+    const __m256i step    = _mm256_set1_epi64x(4 * CAN_DBC_PLAN_PADDED_BYTES);
+    __m256i index         = _mm256_setr_epi64x(0, CAN_DBC_PLAN_PADDED_BYTES,
+                                               2 * CAN_DBC_PLAN_PADDED_BYTES, 3 * CAN_DBC_PLAN_PADDED_BYTES);
+
+    // Every lane reads 8 bytes at byteOffset of its own padded copy, so it stays in bounds
+    const long long *base = reinterpret_cast<const long long *>(payloads[0] + plan.byteOffset);
+
+    int n = 0;
+    for (; n + 4 <= count; n += 4) {
+        __m256i raw = _mm256_i64gather_epi64(base, index, 1);
+        if (plan.bigEndian)
+            raw = _mm256_shuffle_epi8(raw, swap);
+        raw = _mm256_and_si256(_mm256_srl_epi64(raw, shift), mask);
+        raw = _mm256_sub_epi64(_mm256_xor_si256(raw, signBit), signBit);
+        const __m256d value = _mm256_sub_pd(_mm256_castsi256_pd(_mm256_add_epi64(raw, magic)), magicPd);
+        _mm256_storeu_pd(out + n, _mm256_fmadd_pd(value, scale, offset));
+        index = _mm256_add_epi64(index, step);
+    }
+    extractSse2(plan, payloads + n, count - n, out + n);
+}
+
+bool cpuHasAvx2Fma()
+{
+    static const bool supported = __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+    return supported;
+}
+
+#endif // CAN_DBC_BATCH_X86
+
+void extractColumn(const CanDBC::SignalPlan &plan, const PaddedPayload *payloads, int count, double *out)
+{
+#ifdef CAN_DBC_BATCH_X86
+    if (plan.valueType == static_cast<uint8_t>(CanDBC::ValueType::Integer) &&
+        (plan.mask >> CAN_DBC_BATCH_VECTOR_BITS) == 0) {
+        if (cpuHasAvx2Fma())
+            extractAvx2(plan, payloads, count, out);
+        else
+            extractSse2(plan, payloads, count, out);
+        return;
+    }
+#endif
+    extractScalar(plan, payloads, count, out);
+}
+
+} // namespace
+
+int CanDBC::decodeBatch(uint32_t messageId, const CanFrame *frames, int frameCount, double *columns, int capacity) const
+{
+    const MessagePlan *mp = findMessage(static_cast<int>(messageId));
+    if (!mp || frameCount <= 0 || static_cast<qint64>(mp->signalCount) * frameCount > capacity)
+        return 0;
+
+    const double missing = std::numeric_limits<double>::quiet_NaN();
+    const SignalPlan *plans = signalPlans.constData() + mp->firstSignal;
+    PaddedPayload payloads[CAN_DBC_BATCH_CHUNK];
+    uint8_t lengths[CAN_DBC_BATCH_CHUNK];
+
+    // Bytes past CanFrame::data are never written below, so they stay zero for every chunk
+    memset(payloads, 0, sizeof(payloads[0]) * static_cast<size_t>(qMin(CAN_DBC_BATCH_CHUNK, frameCount)));
+
+    for (int first = 0; first < frameCount; first += CAN_DBC_BATCH_CHUNK) {
+        const int count = qMin(CAN_DBC_BATCH_CHUNK, frameCount - first);
+
+        // Same zero-padded staging as decodeFrame(), one row per frame
+        int shortest = CAN_DBC_PLAN_MAX_PAYLOAD;
+        for (int n = 0; n < count; ++n) {
+            const CanFrame &frame = frames[first + n];
+            const int len = qBound(0, static_cast<int>(frame.len), static_cast<int>(sizeof(frame.data)));
+            memcpy(payloads[n], frame.data, static_cast<size_t>(len));
+            memset(payloads[n] + len, 0, sizeof(frame.data) - static_cast<size_t>(len));
+            lengths[n] = static_cast<uint8_t>(len);
+            shortest = qMin(shortest, len);
+        }
+
+        for (int s = 0; s < mp->signalCount; ++s) {
+            double *out = columns + static_cast<qint64>(s) * frameCount + first;
+            if (plans[s].minLength > CAN_DBC_PLAN_MAX_PAYLOAD) {
+                std::fill(out, out + count, missing);   // Layout the plan could not compile
+                continue;
+            }
+
+            extractColumn(plans[s], payloads, count, out);
+
+            // Frames too short for the signal get NaN instead of a value read from padding
+            if (plans[s].minLength > shortest) {
+                for (int n = 0; n < count; ++n) {
+                    if (plans[s].minLength > lengths[n])
+                        out[n] = missing;
+                }
+            }
+        }
+    }
+    return mp->signalCount;
+}
@@ -0,0 +1,115 @@
+#include <CanDecodePool.h>
+#include <CanDbc.h>
+
+#include <QThread>
+#include <QtConcurrent>
+
+// Jobs pulled from a worker queue per wakeup
+#define DECODE_WORKER_BATCH     256
+
+CanDecodePool::CanDecodePool(const CanDBC &dbc) noexcept
+    : dbc(dbc)
+{
+}
+
+CanDecodePool::~CanDecodePool(void) noexcept
+{
+    Stop();
+}
+
+void CanDecodePool::Start(int workerCount)
+{
+    Stop();
+
+    if (workerCount <= 0)
+        workerCount = qBound(1, QThread::idealThreadCount() - 2, 4);
+
+    threadPool.setMaxThreadCount(workerCount);
+    running = true;
+    for (int i = 0; i < workerCount; ++i) {
+        Worker *worker = new Worker();
+        workers.append(worker);
+        worker->future = QtConcurrent::run(&threadPool, [this, worker]() { Run(worker); });
+    }
+    qDebug() << "🧵 Decode pool started:" << workerCount << "worker(s)";
+}
+
+void CanDecodePool::Stop(void)
+{
+    if (workers.isEmpty())
+        return;
+
+    running = false;
+    for (Worker *worker : std::as_const(workers))
+        worker->queue.Close();
+    for (Worker *worker : std::as_const(workers))
+        worker->future.waitForFinished();
+
+    qDeleteAll(workers);
+    workers.clear();
+}
+
+bool CanDecodePool::Submit(const CanFrame &frame, qint64 timestampInMs)
+{
+    if (workers.isEmpty())
+        return false;
+
+    Worker *worker = workers[static_cast<int>(frame.id % static_cast<uint32_t>(workers.size()))];
+    return worker->queue.Push(Job{frame, timestampInMs});
+}
+
+void CanDecodePool::Collect(CanUiSnapshot &snapshot)
+{
+    for (Worker *worker : std::as_const(workers)) {
+        QMutexLocker locker(&worker->mutex);
+        snapshot.merge(worker->partial);
+    }
+}
+
+size_t CanDecodePool::Backlog(void) const
+{
+    size_t total = 0;
+    for (const Worker *worker : workers)
+        total += worker->queue.Size();
+    return total;
+}
+
+void CanDecodePool::Run(Worker *worker)
+{
+    Job jobs[DECODE_WORKER_BATCH];
+    QVector<CanDBC::DecodedSignal> decoded;
+
+    while (running) {
+        if (!worker->queue.WaitForData(100))
+            continue;
+
+        size_t count = worker->queue.PopBatch(jobs, DECODE_WORKER_BATCH);
+        if (count == 0)
+            continue;
+
+        // Sized once per DBC; the per-frame path below never allocates for decoding
+        if (decoded.size() < dbc.maxSignalsPerMessage())
+            decoded.resize(dbc.maxSignalsPerMessage());
+
+        // Decode outside the lock, publish the batch under it
+        CanUiSnapshot local;
+        for (size_t i = 0; i < count; ++i) {
+            const CanFrame &frame = jobs[i].frame;
+
+            double cycleTimeMs = -1.0;
+            auto last = worker->lastTimestampsUs.find(frame.id);
+            if (last != worker->lastTimestampsUs.end()) {
+                cycleTimeMs = static_cast<double>(frame.timestampUs - last.value()) / 1000.0;
+                last.value() = frame.timestampUs;
+            } else {
+                worker->lastTimestampsUs.insert(frame.id, frame.timestampUs);
+            }
+
+            const int n = dbc.decodeFrame(frame.id, frame.data, frame.len, decoded.data(), static_cast<int>(decoded.size()));
+            local.add(frame, decoded.constData(), n, jobs[i].timestampInMs, cycleTimeMs);
+        }
+
+        QMutexLocker locker(&worker->mutex);
+        worker->partial.merge(local);
+    }
+}
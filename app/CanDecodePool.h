@@ -0,0 +1,71 @@
+#ifndef CANDECODEPOOL_H
+#define CANDECODEPOOL_H
+
+#include <CanFrame.h>
+#include <CanRingBuffer.h>
+#include <CanUiSnapshot.h>
+
+#include <QFuture>
+#include <QHash>
+#include <QList>
+#include <QMutex>
+#include <QThreadPool>
+
+#include <atomic>
+
+class CanDBC;
+
+// Frames queued per decode worker (rounded up to a power of two)
+#define DECODE_WORKER_QUEUE_CAPACITY    8192
+
+// DBC decode stage between acquisition and the GUI.
+// Frames are sharded by CAN ID so each ID is always decoded by the same
+// worker, which keeps per-ID ordering and cycle times intact. Each worker
+// folds its results into a private snapshot; Collect() merges them.
+class CanDecodePool
+{
+public:
+    explicit CanDecodePool(const CanDBC &dbc) noexcept;
+    ~CanDecodePool(void) noexcept;
+
+    /// Spawn the workers. workerCount <= 0 picks one per spare core (1..4).
+    void Start(int workerCount = 0);
+
+    /// Stop and join the workers; undecoded frames are discarded.
+    void Stop(void);
+
+    /// Hand a raw frame to its worker. Dispatcher thread only; blocks while
+    /// that worker's queue is full so backpressure reaches the acquisition ring.
+    bool Submit(const CanFrame &frame, qint64 timestampInMs);
+
+    /// Move everything decoded so far into snapshot.
+    void Collect(CanUiSnapshot &snapshot);
+
+    int WorkerCount(void) const { return workers.size(); }
+    size_t Backlog(void) const;
+
+private:
+    struct Job {
+        CanFrame frame;
+        qint64 timestampInMs;
+    };
+
+    struct Worker {
+        Worker(void) : queue(DECODE_WORKER_QUEUE_CAPACITY, CanRingBuffer<Job>::OverflowPolicy::Block) {}
+
+        CanRingBuffer<Job> queue;
+        QFuture<void> future;
+        QMutex mutex;                               // Guards partial
+        CanUiSnapshot partial;
+        QHash<uint32_t, uint64_t> lastTimestampsUs; // Worker-local, per ID
+    };
+
+    void Run(Worker *worker);
+
+    const CanDBC &dbc;
+    QThreadPool threadPool;     // Private pool so long-lived workers never starve QtConcurrent
+    QList<Worker *> workers;
+    std::atomic<bool> running{false};
+};
+
+#endif // CANDECODEPOOL_H
@@ -0,0 +1,78 @@
+#ifndef CANDRIVER_H
+#define CANDRIVER_H
+
+#include <stdint.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+// PCANBasic.h only needs the Win32 scalar types for its declarations
+typedef uint8_t  BYTE;
+typedef uint16_t WORD;
+typedef uint32_t DWORD;
+typedef uint64_t UINT64;
+typedef char    *LPSTR;
+#define __stdcall
+#define __T(s) s
+#endif
+#include <PCANBasic.h>
+
+#include <QString>
+#include <CanFrame.h>
+
+// Abstract CAN bus driver.
+// Every backend reports status through the PCAN-Basic error codes (PCAN_ERROR_*)
+// so the UI can keep a single error vocabulary regardless of the hardware.
+class CanDriver
+{
+public:
+    enum class Backend {
+        Pcan,       // PEAK PCAN-Basic API
+        SocketCan   // Linux SocketCAN raw socket
+    };
+
+    virtual ~CanDriver(void) noexcept = default;
+
+    /// Open the channel. Returns PCAN_ERROR_OK on success.
+    virtual int Connect(void) = 0;
+
+    /// Close the channel. Returns PCAN_ERROR_OK on success.
+    virtual int Disconnect(void) = 0;
+
+    /// Read one frame without blocking. Returns PCAN_ERROR_QRCVEMPTY when nothing is pending.
+    virtual int Read(CanFrame &frame) = 0;
+
+    /// Read up to capacity frames into a caller-owned array without blocking.
+    /// count receives the number of frames stored. Returns PCAN_ERROR_OK when at
+    /// least one frame was read, otherwise the status that ended the batch.
+    virtual int ReadBatch(CanFrame *frames, int capacity, int &count);
+
+    /// Sleep on the driver's receive event until frames are pending or the
+    /// timeout expires. Returns PCAN_ERROR_OK when Read() has data to drain,
+    /// PCAN_ERROR_QRCVEMPTY on timeout.
+    virtual int WaitForReceive(int timeoutMs) = 0;
+
+    /// Queue one frame for transmission.
+    virtual int Write(const CanFrame &frame) = 0;
+
+    /// Current bus/controller status (PCAN_ERROR_BUS* bits).
+    virtual int GetStatus(void) = 0;
+
+    /// Drop everything pending in the receive/transmit queues.
+    virtual void Reset(void) = 0;
+
+    /// Human readable channel name for the status bar.
+    virtual QString Name(void) const = 0;
+};
+
+// Generic batch read: loop Read() until the queue is empty or the array is full
+inline int CanDriver::ReadBatch(CanFrame *frames, int capacity, int &count)
+{
+    int status = PCAN_ERROR_QRCVEMPTY;
+    count = 0;
+    while (count < capacity && (status = Read(frames[count])) == PCAN_ERROR_OK)
+        ++count;
+    return count > 0 ? PCAN_ERROR_OK : status;
+}
+
+#endif // CANDRIVER_H
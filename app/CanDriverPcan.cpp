@@ -0,0 +1,133 @@
+#include <CanDriverPcan.h>
+
+#include <string.h>
+
+#include <QDebug>
+
+CanDriverPcan::CanDriverPcan(TPCANHandle handle, TPCANBaudrate bitRate) noexcept
+    : handle(handle)
+    , bitRate(bitRate)
+    , rxEvent(nullptr)
+{
+}
+
+CanDriverPcan::~CanDriverPcan(void) noexcept
+{
+    // Channel is released by Disconnect()
+    if (rxEvent)
+        CloseHandle(rxEvent);
+}
+
+int CanDriverPcan::Connect(void)
+{
+    TPCANStatus status = CAN_Initialize(handle, bitRate);
+    qDebug() << "🔧 CAN connect:"
+             << "Handle =" << QString("0x%1").arg(handle, 0, 16).toUpper()
+             << ", Bitrate =" << QString("0x%1").arg(bitRate, 0, 16).toUpper();
+
+    if (status == PCAN_ERROR_OK)
+    {
+        qDebug("CAN_Initialize(): %lu", static_cast<unsigned long>(status));
+    } else {
+        qDebug("CAN_Initialize() failed: %lu", static_cast<unsigned long>(status));
+    }
+    status = CAN_Reset(handle);
+    qDebug("CAN_Reset(): %lX", static_cast<unsigned long>(status));
+
+    status = CAN_FilterMessages(handle, 0x001, 0x7FF, PCAN_MODE_STANDARD);
+    qDebug("CAN_FilterMessages(): %lX", static_cast<unsigned long>(status));
+    if (status != PCAN_ERROR_OK)
+        return static_cast<int>(status);
+
+    // Auto-reset event the driver signals on every received frame
+    if (!rxEvent)
+        rxEvent = CreateEvent(nullptr, FALSE, FALSE, nullptr);
+    status = CAN_SetValue(handle, PCAN_RECEIVE_EVENT, &rxEvent, sizeof(rxEvent));
+    qDebug("CAN_SetValue(PCAN_RECEIVE_EVENT): %lX", static_cast<unsigned long>(status));
+    return static_cast<int>(status);
+}
+
+int CanDriverPcan::Disconnect(void)
+{
+    HANDLE noEvent = nullptr;
+    CAN_SetValue(handle, PCAN_RECEIVE_EVENT, &noEvent, sizeof(noEvent));
+
+    TPCANStatus status = CAN_Uninitialize(handle);
+    if (status == PCAN_ERROR_OK)
+    {
+        qDebug("CAN_Uninitialize(): %lu", static_cast<unsigned long>(status));
+    } else {
+        qDebug("CAN_Uninitialize() failed: %lu", static_cast<unsigned long>(status));
+    }
+    return static_cast<int>(status);
+}
+
+int CanDriverPcan::Read(CanFrame &frame)
+{
+    TPCANMsg msg;
+    TPCANTimestamp ts;
+    TPCANStatus status = CAN_Read(handle, &msg, &ts);
+    if (status != PCAN_ERROR_OK)
+        return static_cast<int>(status);
+
+    // Total Microseconds = micros + (1000ULL * millis) + (0x100000000ULL * 1000ULL * millis_overflow)
+    frame.timestampUs = ts.micros +
+                        (1000ULL * ts.millis) +
+                        (0x100000000ULL * 1000ULL * ts.millis_overflow);
+    frame.id = msg.ID;
+    frame.flags = 0;
+    if (msg.MSGTYPE & PCAN_MESSAGE_EXTENDED) frame.flags |= CanFrame::Extended;
+    if (msg.MSGTYPE & PCAN_MESSAGE_RTR)      frame.flags |= CanFrame::Remote;
+    if (msg.MSGTYPE & PCAN_MESSAGE_ERRFRAME) frame.flags |= CanFrame::Error;
+    frame.len = msg.LEN > 8 ? 8 : msg.LEN;
+    memcpy(frame.data, msg.DATA, sizeof(frame.data));
+    return PCAN_ERROR_OK;
+}
+
+int CanDriverPcan::WaitForReceive(int timeoutMs)
+{
+    if (!rxEvent)
+        return PCAN_ERROR_INITIALIZE;
+
+    DWORD result = WaitForSingleObject(rxEvent, static_cast<DWORD>(timeoutMs));
+    if (result == WAIT_OBJECT_0)
+        return PCAN_ERROR_OK;
+    if (result == WAIT_TIMEOUT)
+        return PCAN_ERROR_QRCVEMPTY;
+    return PCAN_ERROR_RESOURCE;
+}
+
+int CanDriverPcan::Write(const CanFrame &frame)
+{
+    TPCANMsg msg;
+    msg.ID = frame.id;
+    msg.MSGTYPE = (frame.flags & CanFrame::Extended) ? PCAN_MESSAGE_EXTENDED : PCAN_MESSAGE_STANDARD;
+    if (frame.flags & CanFrame::Remote)
+        msg.MSGTYPE |= PCAN_MESSAGE_RTR;
+    msg.LEN = frame.len > 8 ? 8 : frame.len;
+    memcpy(msg.DATA, frame.data, sizeof(msg.DATA));
+    return static_cast<int>(CAN_Write(handle, &msg));
+}
+
+int CanDriverPcan::GetStatus(void)
+{
+    return static_cast<int>(CAN_GetStatus(handle));
+}
+
+void CanDriverPcan::Reset(void)
+{
+    CAN_Reset(handle);
+    {
+        TPCANMsg dummy{};
+        TPCANTimestamp ts{};
+        while (CAN_Read(handle, &dummy, &ts) == PCAN_ERROR_OK)
+        {
+            // discard
+        }
+    }
+}
+
+QString CanDriverPcan::Name(void) const
+{
+    return QString("PCAN 0x%1").arg(handle, 0, 16).toUpper();
+}
@@ -0,0 +1,28 @@
+#ifndef CANDRIVERPCAN_H
+#define CANDRIVERPCAN_H
+
+#include <CanDriver.h>
+
+// PEAK PCAN-Basic backend
+class CanDriverPcan : public CanDriver
+{
+public:
+    CanDriverPcan(TPCANHandle handle, TPCANBaudrate bitRate) noexcept;
+    ~CanDriverPcan(void) noexcept override;
+
+    int Connect(void) override;
+    int Disconnect(void) override;
+    int Read(CanFrame &frame) override;
+    int WaitForReceive(int timeoutMs) override;
+    int Write(const CanFrame &frame) override;
+    int GetStatus(void) override;
+    void Reset(void) override;
+    QString Name(void) const override;
+
+private:
+    TPCANHandle handle;
+    TPCANBaudrate bitRate;
+    HANDLE rxEvent;     // Signalled by the driver when the receive queue gets a frame
+};
+
+#endif // CANDRIVERPCAN_H
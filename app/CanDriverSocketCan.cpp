@@ -0,0 +1,300 @@
+#include <CanDriverSocketCan.h>
+
+#include <errno.h>
+#include <string.h>
+#include <unistd.h>
+#include <poll.h>
+#include <net/if.h>
+#include <sys/ioctl.h>
+#include <sys/socket.h>
+#include <linux/can.h>
+#include <linux/can/raw.h>
+#include <linux/can/error.h>
+
+#include <QDebug>
+
+// Large kernel receive buffer so bursts survive scheduling hiccups
+#define SOCKETCAN_RX_BUFFER_BYTES   (4 * 1024 * 1024)
+
+CanDriverSocketCan::CanDriverSocketCan(const QString &ifName) noexcept
+    : ifName(ifName)
+    , fd(-1)
+    , busStatus(PCAN_ERROR_OK)
+    , rxDropCount(0)
+{
+    for (int i = 0; i < SOCKETCAN_BATCH_MAX; ++i) {
+        batchIov[i].iov_base = &batchFrames[i];
+        batchIov[i].iov_len = sizeof(batchFrames[i]);
+    }
+}
+
+CanDriverSocketCan::~CanDriverSocketCan(void) noexcept
+{
+    if (fd >= 0)
+        ::close(fd);
+}
+
+int CanDriverSocketCan::Connect(void)
+{
+    qDebug() << "🔧 SocketCAN connect:" << "Interface =" << ifName;
+
+    if (fd >= 0)
+        Disconnect();
+
+    fd = ::socket(PF_CAN, SOCK_RAW, CAN_RAW);
+    if (fd < 0) {
+        qDebug("socket(PF_CAN) failed: %s", strerror(errno));
+        return PCAN_ERROR_NODRIVER;
+    }
+
+    struct ifreq ifr;
+    memset(&ifr, 0, sizeof(ifr));
+    strncpy(ifr.ifr_name, ifName.toLocal8Bit().constData(), IFNAMSIZ - 1);
+    if (::ioctl(fd, SIOCGIFINDEX, &ifr) < 0) {
+        qDebug("SIOCGIFINDEX(%s) failed: %s", ifr.ifr_name, strerror(errno));
+        ::close(fd);
+        fd = -1;
+        return PCAN_ERROR_ILLHW;
+    }
+
+    // Standard frames only, same acceptance range as the PCAN backend
+    struct can_filter filter;
+    filter.can_id = 0;
+    filter.can_mask = CAN_EFF_FLAG;
+    ::setsockopt(fd, SOL_CAN_RAW, CAN_RAW_FILTER, &filter, sizeof(filter));
+
+    // Controller state changes arrive as error frames
+    can_err_mask_t errMask = CAN_ERR_CRTL | CAN_ERR_BUSOFF | CAN_ERR_RESTARTED;
+    ::setsockopt(fd, SOL_CAN_RAW, CAN_RAW_ERR_FILTER, &errMask, sizeof(errMask));
+
+    // Kernel receive timestamps and dropped-frame counter in ancillary data
+    int on = 1;
+    ::setsockopt(fd, SOL_SOCKET, SO_TIMESTAMPNS, &on, sizeof(on));
+    ::setsockopt(fd, SOL_SOCKET, SO_RXQ_OVFL, &on, sizeof(on));
+
+    int rcvBuf = SOCKETCAN_RX_BUFFER_BYTES;
+    ::setsockopt(fd, SOL_SOCKET, SO_RCVBUF, &rcvBuf, sizeof(rcvBuf));
+
+    struct sockaddr_can addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.can_family = AF_CAN;
+    addr.can_ifindex = ifr.ifr_ifindex;
+    if (::bind(fd, reinterpret_cast<struct sockaddr *>(&addr), sizeof(addr)) < 0) {
+        qDebug("bind(%s) failed: %s", ifr.ifr_name, strerror(errno));
+        ::close(fd);
+        fd = -1;
+        return PCAN_ERROR_NETINUSE;
+    }
+
+    busStatus = PCAN_ERROR_OK;
+    rxDropCount = 0;
+    qDebug("SocketCAN bound to %s (ifindex %d)", ifr.ifr_name, ifr.ifr_ifindex);
+    return PCAN_ERROR_OK;
+}
+
+int CanDriverSocketCan::Disconnect(void)
+{
+    if (fd < 0)
+        return PCAN_ERROR_INITIALIZE;
+
+    ::close(fd);
+    fd = -1;
+    qDebug() << "SocketCAN closed:" << ifName;
+    return PCAN_ERROR_OK;
+}
+
+int CanDriverSocketCan::ReadFromSocket(CanFrame &frame)
+{
+    struct can_frame cf;
+    struct iovec iov;
+    iov.iov_base = &cf;
+    iov.iov_len = sizeof(cf);
+
+    char control[CMSG_SPACE(sizeof(struct timespec)) + CMSG_SPACE(sizeof(uint32_t))];
+    struct msghdr msg;
+    memset(&msg, 0, sizeof(msg));
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    msg.msg_control = control;
+    msg.msg_controllen = sizeof(control);
+
+    ssize_t n = ::recvmsg(fd, &msg, MSG_DONTWAIT);
+    if (n < 0) {
+        if (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR)
+            return PCAN_ERROR_QRCVEMPTY;
+        return PCAN_ERROR_UNKNOWN;
+    }
+    if (n < static_cast<ssize_t>(sizeof(cf)))
+        return PCAN_ERROR_ILLDATA;
+
+    ParseMessage(cf, msg, frame);
+    return PCAN_ERROR_OK;
+}
+
+void CanDriverSocketCan::ParseMessage(const struct can_frame &cf, struct msghdr &msg, CanFrame &frame)
+{
+    frame.timestampUs = 0;
+    for (struct cmsghdr *c = CMSG_FIRSTHDR(&msg); c; c = CMSG_NXTHDR(&msg, c)) {
+        if (c->cmsg_level != SOL_SOCKET)
+            continue;
+        if (c->cmsg_type == SCM_TIMESTAMPNS) {
+            struct timespec ts;
+            memcpy(&ts, CMSG_DATA(c), sizeof(ts));
+            frame.timestampUs = static_cast<uint64_t>(ts.tv_sec) * 1000000ULL +
+                                static_cast<uint64_t>(ts.tv_nsec) / 1000ULL;
+        } else if (c->cmsg_type == SO_RXQ_OVFL) {
+            uint32_t dropped;
+            memcpy(&dropped, CMSG_DATA(c), sizeof(dropped));
+            if (dropped != rxDropCount) {
+                qWarning() << "⚠️ SocketCAN queue overrun:" << (dropped - rxDropCount) << "frames lost!";
+                rxDropCount = dropped;
+            }
+        }
+    }
+
+    if (cf.can_id & CAN_ERR_FLAG) {
+        if (cf.can_id & CAN_ERR_BUSOFF) {
+            busStatus = PCAN_ERROR_BUSOFF;
+        } else if (cf.can_id & CAN_ERR_RESTARTED) {
+            busStatus = PCAN_ERROR_OK;
+        } else if (cf.can_id & CAN_ERR_CRTL) {
+            if (cf.data[1] & (CAN_ERR_CRTL_RX_PASSIVE | CAN_ERR_CRTL_TX_PASSIVE))
+                busStatus = PCAN_ERROR_BUSPASSIVE;
+            else if (cf.data[1] & (CAN_ERR_CRTL_RX_WARNING | CAN_ERR_CRTL_TX_WARNING))
+                busStatus = PCAN_ERROR_BUSLIGHT;
+#ifdef CAN_ERR_CRTL_ACTIVE
+            else if (cf.data[1] & CAN_ERR_CRTL_ACTIVE)
+                busStatus = PCAN_ERROR_OK;
+#endif
+        }
+        frame.id = cf.can_id & CAN_ERR_MASK;
+        frame.flags = CanFrame::Error;
+    } else {
+        frame.id = cf.can_id & ((cf.can_id & CAN_EFF_FLAG) ? CAN_EFF_MASK : CAN_SFF_MASK);
+        frame.flags = 0;
+        if (cf.can_id & CAN_EFF_FLAG) frame.flags |= CanFrame::Extended;
+        if (cf.can_id & CAN_RTR_FLAG) frame.flags |= CanFrame::Remote;
+    }
+    frame.len = cf.can_dlc > 8 ? 8 : cf.can_dlc;
+    memcpy(frame.data, cf.data, sizeof(frame.data));
+}
+
+int CanDriverSocketCan::Read(CanFrame &frame)
+{
+    if (fd < 0)
+        return PCAN_ERROR_INITIALIZE;
+
+    // Error frames only update the bus state; they are not data traffic
+    int status;
+    do {
+        status = ReadFromSocket(frame);
+    } while (status == PCAN_ERROR_OK && (frame.flags & CanFrame::Error));
+    return status;
+}
+
+int CanDriverSocketCan::ReadBatch(CanFrame *frames, int capacity, int &count)
+{
+    count = 0;
+    if (fd < 0)
+        return PCAN_ERROR_INITIALIZE;
+
+    while (count < capacity) {
+        int want = capacity - count;
+        if (want > SOCKETCAN_BATCH_MAX)
+            want = SOCKETCAN_BATCH_MAX;
+
+        for (int i = 0; i < want; ++i) {
+            struct msghdr &msg = batchMsgs[i].msg_hdr;
+            memset(&msg, 0, sizeof(msg));
+            msg.msg_iov = &batchIov[i];
+            msg.msg_iovlen = 1;
+            msg.msg_control = batchControl[i];
+            msg.msg_controllen = sizeof(batchControl[i]);
+            batchMsgs[i].msg_len = 0;
+        }
+
+        // One syscall for the whole batch
+        int n = ::recvmmsg(fd, batchMsgs, static_cast<unsigned int>(want), MSG_DONTWAIT, nullptr);
+        if (n < 0) {
+            if (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR)
+                break;
+            return count > 0 ? PCAN_ERROR_OK : PCAN_ERROR_UNKNOWN;
+        }
+
+        for (int i = 0; i < n; ++i) {
+            if (batchMsgs[i].msg_len < sizeof(struct can_frame))
+                continue;
+            CanFrame &frame = frames[count];
+            ParseMessage(batchFrames[i], batchMsgs[i].msg_hdr, frame);
+            if (!(frame.flags & CanFrame::Error))
+                ++count;
+        }
+
+        if (n < want)
+            break;
+    }
+    return count > 0 ? PCAN_ERROR_OK : PCAN_ERROR_QRCVEMPTY;
+}
+
+int CanDriverSocketCan::WaitForReceive(int timeoutMs)
+{
+    if (fd < 0)
+        return PCAN_ERROR_INITIALIZE;
+
+    struct pollfd pfd;
+    pfd.fd = fd;
+    pfd.events = POLLIN;
+    pfd.revents = 0;
+
+    int n = ::poll(&pfd, 1, timeoutMs);
+    if (n > 0 && (pfd.revents & POLLIN))
+        return PCAN_ERROR_OK;
+    if (n == 0 || (n < 0 && errno == EINTR))
+        return PCAN_ERROR_QRCVEMPTY;
+    return PCAN_ERROR_UNKNOWN;
+}
+
+int CanDriverSocketCan::Write(const CanFrame &frame)
+{
+    if (fd < 0)
+        return PCAN_ERROR_INITIALIZE;
+
+    struct can_frame cf;
+    memset(&cf, 0, sizeof(cf));
+    cf.can_id = frame.id;
+    if (frame.flags & CanFrame::Extended) cf.can_id |= CAN_EFF_FLAG;
+    if (frame.flags & CanFrame::Remote)   cf.can_id |= CAN_RTR_FLAG;
+    cf.can_dlc = frame.len > 8 ? 8 : frame.len;
+    memcpy(cf.data, frame.data, cf.can_dlc);
+
+    ssize_t n = ::write(fd, &cf, sizeof(cf));
+    if (n == static_cast<ssize_t>(sizeof(cf)))
+        return PCAN_ERROR_OK;
+    if (n < 0 && (errno == ENOBUFS || errno == EAGAIN))
+        return PCAN_ERROR_QXMTFULL;
+    return PCAN_ERROR_UNKNOWN;
+}
+
+int CanDriverSocketCan::GetStatus(void)
+{
+    if (fd < 0)
+        return PCAN_ERROR_INITIALIZE;
+    return busStatus;
+}
+
+void CanDriverSocketCan::Reset(void)
+{
+    if (fd < 0)
+        return;
+
+    CanFrame dummy;
+    while (ReadFromSocket(dummy) == PCAN_ERROR_OK)
+    {
+        // discard
+    }
+}
+
+QString CanDriverSocketCan::Name(void) const
+{
+    return ifName;
+}
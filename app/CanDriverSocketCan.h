@@ -0,0 +1,46 @@
+#ifndef CANDRIVERSOCKETCAN_H
+#define CANDRIVERSOCKETCAN_H
+
+#include <CanDriver.h>
+
+#include <linux/can.h>
+#include <sys/socket.h>
+
+// Frames fetched from the kernel per recvmmsg() call
+#define SOCKETCAN_BATCH_MAX         64
+
+// Linux SocketCAN raw-socket backend.
+// The bit rate is owned by the network interface ("ip link set can0 type can bitrate ...").
+class CanDriverSocketCan : public CanDriver
+{
+public:
+    explicit CanDriverSocketCan(const QString &ifName) noexcept;
+    ~CanDriverSocketCan(void) noexcept override;
+
+    int Connect(void) override;
+    int Disconnect(void) override;
+    int Read(CanFrame &frame) override;
+    int ReadBatch(CanFrame *frames, int capacity, int &count) override;
+    int WaitForReceive(int timeoutMs) override;
+    int Write(const CanFrame &frame) override;
+    int GetStatus(void) override;
+    void Reset(void) override;
+    QString Name(void) const override;
+
+private:
+    int ReadFromSocket(CanFrame &frame);
+    void ParseMessage(const struct can_frame &cf, struct msghdr &msg, CanFrame &frame);
+
+    QString ifName;
+    int fd;
+    int busStatus;          // Last controller state seen in an error frame
+    uint32_t rxDropCount;   // Kernel SO_RXQ_OVFL counter of the last frame
+
+    // recvmmsg() scratch, allocated once with the driver
+    struct can_frame batchFrames[SOCKETCAN_BATCH_MAX];
+    struct iovec batchIov[SOCKETCAN_BATCH_MAX];
+    struct mmsghdr batchMsgs[SOCKETCAN_BATCH_MAX];
+    char batchControl[SOCKETCAN_BATCH_MAX][CMSG_SPACE(sizeof(struct timespec)) + CMSG_SPACE(sizeof(uint32_t))];
+};
+
+#endif // CANDRIVERSOCKETCAN_H
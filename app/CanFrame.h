@@ -0,0 +1,23 @@
+#ifndef CANFRAME_H
+#define CANFRAME_H
+
+#include <stdint.h>
+
+// Backend-neutral CAN frame record.
+// Plain old data so it can be copied into queues and files without constructors.
+struct CanFrame
+{
+    enum Flag : uint8_t {
+        Extended = 0x01,    // 29-bit identifier
+        Remote   = 0x02,    // Remote transmission request
+        Error    = 0x04,    // Error frame reported by the controller
+    };
+
+    uint64_t timestampUs;   // Receive time in microseconds (driver/kernel clock)
+    uint32_t id;            // 11/29-bit identifier
+    uint8_t  flags;         // Combination of Flag values
+    uint8_t  len;           // Payload length in bytes (0..8)
+    uint8_t  data[8];       // Payload
+};
+
+#endif // CANFRAME_H
@@ -0,0 +1,247 @@
+#ifndef CANRINGBUFFER_H
+#define CANRINGBUFFER_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+// Bounded single-producer/single-consumer ring of POD records.
+//
+// Push/Pop are lock-free. The mutex/condition variable are only touched when
+// one side actually has to sleep (consumer on empty, producer on full with
+// the Block policy), so a busy bus never takes a lock per frame.
+//
+// DropOldest lets the producer advance the read index; the consumer claims a
+// slot with a CAS and discards its copy if the producer overtook it, which is
+// why T has to be trivially copyable.
+template <typename T>
+class CanRingBuffer
+{
+    static_assert(std::is_trivially_copyable<T>::value, "CanRingBuffer holds POD records only");
+
+public:
+    enum class OverflowPolicy {
+        DropOldest,     // Overwrite the oldest unread record
+        DropNewest,     // Discard the record being pushed
+        Block           // Wait for the consumer to make room
+    };
+
+    explicit CanRingBuffer(size_t capacity, OverflowPolicy policy = OverflowPolicy::DropOldest)
+        : policy(policy)
+    {
+        size_t cap = 2;
+        while (cap < capacity)
+            cap <<= 1;
+        slots.resize(cap);
+        mask = cap - 1;
+    }
+
+    CanRingBuffer(const CanRingBuffer &) = delete;
+    CanRingBuffer &operator=(const CanRingBuffer &) = delete;
+
+    // --- Producer side ---
+
+    /// Push one record. Returns false when the record was dropped (DropNewest)
+    /// or the ring was closed while blocking.
+    bool Push(const T &item)
+    {
+        return PushBatch(&item, 1) == 1;
+    }
+
+    /// Push up to n records; returns how many were accepted.
+    size_t PushBatch(const T *items, size_t n)
+    {
+        size_t pushed = 0;
+        uint64_t t = tail.load(std::memory_order_relaxed);
+
+        while (pushed < n) {
+            if (t - headCache >= slots.size()) {
+                headCache = head.load(std::memory_order_acquire);
+                if (t - headCache >= slots.size()) {
+                    if (policy == OverflowPolicy::DropNewest) {
+                        drops.fetch_add(n - pushed, std::memory_order_relaxed);
+                        break;
+                    }
+                    if (policy == OverflowPolicy::DropOldest) {
+                        // Publish first so head never overtakes the visible tail,
+                        // then claim the oldest slot unless the consumer just freed it
+                        tail.store(t, std::memory_order_release);
+                        uint64_t h = headCache;
+                        if (head.compare_exchange_strong(h, h + 1, std::memory_order_acq_rel))
+                            drops.fetch_add(1, std::memory_order_relaxed);
+                        headCache = head.load(std::memory_order_acquire);
+                        continue;
+                    }
+                    // Block: publish what we have so the consumer can drain it
+                    tail.store(t, std::memory_order_release);
+                    NotifyConsumer();
+                    if (!WaitForSpace(t))
+                        break;
+                    continue;
+                }
+            }
+
+            memcpy(&slots[t & mask], &items[pushed], sizeof(T));
+            ++t;
+            ++pushed;
+        }
+
+        tail.store(t, std::memory_order_release);
+        UpdateHighWatermark(t);
+        if (pushed)
+            NotifyConsumer();
+        return pushed;
+    }
+
+    // --- Consumer side ---
+
+    /// Pop one record. Returns false when the ring is empty.
+    bool Pop(T &item)
+    {
+        return PopBatch(&item, 1) == 1;
+    }
+
+    /// Pop up to max records into out; returns how many were read.
+    size_t PopBatch(T *out, size_t max)
+    {
+        size_t popped = 0;
+        while (popped < max) {
+            uint64_t h = head.load(std::memory_order_acquire);
+            if (h >= tailCache) {
+                tailCache = tail.load(std::memory_order_acquire);
+                if (h >= tailCache)
+                    break;
+            }
+
+            memcpy(&out[popped], &slots[h & mask], sizeof(T));
+            if (policy == OverflowPolicy::DropOldest) {
+                // The producer may have dropped this slot while we copied it
+                if (!head.compare_exchange_strong(h, h + 1, std::memory_order_acq_rel))
+                    continue;
+            } else {
+                head.store(h + 1, std::memory_order_release);
+            }
+            ++popped;
+        }
+
+        if (popped && policy == OverflowPolicy::Block && producerWaiting.load(std::memory_order_seq_cst)) {
+            std::lock_guard<std::mutex> locker(waitMutex);
+            notFull.notify_one();
+        }
+        return popped;
+    }
+
+    /// Sleep until at least one record is available, the ring is closed or the
+    /// timeout expires. Returns true when data is available.
+    bool WaitForData(int timeoutMs)
+    {
+        if (!IsEmpty())
+            return true;
+
+        std::unique_lock<std::mutex> locker(waitMutex);
+        consumerWaiting.store(true, std::memory_order_seq_cst);
+        notEmpty.wait_for(locker, std::chrono::milliseconds(timeoutMs), [this]() {
+            return !IsEmpty() || closed.load(std::memory_order_acquire);
+        });
+        consumerWaiting.store(false, std::memory_order_relaxed);
+        return !IsEmpty();
+    }
+
+    // --- Either side / control ---
+
+    /// Wake every waiter and make blocking pushes fail until Open() is called.
+    void Close(void)
+    {
+        closed.store(true, std::memory_order_release);
+        std::lock_guard<std::mutex> locker(waitMutex);
+        notEmpty.notify_all();
+        notFull.notify_all();
+    }
+
+    /// Empty the ring and reset statistics. Only call while no thread uses it.
+    void Open(void)
+    {
+        head.store(0, std::memory_order_relaxed);
+        tail.store(0, std::memory_order_relaxed);
+        headCache = 0;
+        tailCache = 0;
+        drops.store(0, std::memory_order_relaxed);
+        highWatermark.store(0, std::memory_order_relaxed);
+        closed.store(false, std::memory_order_release);
+    }
+
+    void SetOverflowPolicy(OverflowPolicy newPolicy) { policy = newPolicy; }   // only while stopped
+    OverflowPolicy GetOverflowPolicy(void) const { return policy; }
+
+    size_t Capacity(void) const { return slots.size(); }
+    size_t Size(void) const
+    {
+        uint64_t t = tail.load(std::memory_order_acquire);
+        uint64_t h = head.load(std::memory_order_acquire);
+        return t > h ? static_cast<size_t>(t - h) : 0;
+    }
+    bool IsEmpty(void) const { return Size() == 0; }
+    uint64_t DropCount(void) const { return drops.load(std::memory_order_relaxed); }
+    size_t HighWatermark(void) const { return highWatermark.load(std::memory_order_relaxed); }
+
+private:
+    void NotifyConsumer(void)
+    {
+        if (consumerWaiting.load(std::memory_order_seq_cst)) {
+            std::lock_guard<std::mutex> locker(waitMutex);
+            notEmpty.notify_one();
+        }
+    }
+
+    bool WaitForSpace(uint64_t t)
+    {
+        std::unique_lock<std::mutex> locker(waitMutex);
+        producerWaiting.store(true, std::memory_order_seq_cst);
+        while (!closed.load(std::memory_order_acquire)) {
+            headCache = head.load(std::memory_order_acquire);
+            if (t - headCache < slots.size())
+                break;
+            notFull.wait_for(locker, std::chrono::milliseconds(10));
+        }
+        producerWaiting.store(false, std::memory_order_relaxed);
+        return !closed.load(std::memory_order_acquire);
+    }
+
+    void UpdateHighWatermark(uint64_t t)
+    {
+        size_t used = static_cast<size_t>(t - headCache);
+        if (used > highWatermark.load(std::memory_order_relaxed))
+            highWatermark.store(used, std::memory_order_relaxed);
+    }
+
+    std::vector<T> slots;
+    size_t mask;
+    OverflowPolicy policy;
+
+    // Consumer-owned index, on its own cache line
+    alignas(64) std::atomic<uint64_t> head{0};
+    uint64_t tailCache = 0;             // Consumer's last view of tail
+
+    // Producer-owned index, on its own cache line
+    alignas(64) std::atomic<uint64_t> tail{0};
+    uint64_t headCache = 0;             // Producer's last view of head
+
+    alignas(64) std::atomic<uint64_t> drops{0};
+    std::atomic<size_t> highWatermark{0};
+    std::atomic<bool> closed{false};
+    std::atomic<bool> consumerWaiting{false};
+    std::atomic<bool> producerWaiting{false};
+    std::mutex waitMutex;
+    std::condition_variable notEmpty;
+    std::condition_variable notFull;
+};
+
+#endif // CANRINGBUFFER_H
@@ -0,0 +1,50 @@
+#include <CanUiSnapshot.h>
+
+#include <algorithm>
+
+void CanUiSnapshot::add(const CanFrame &frame, const CanDBC::DecodedSignal *decoded, int count,
+                        qint64 timestampInMs, double cycleTimeMs)
+{
+    Message &msg = messages[frame.id];
+    msg.frame = frame;
+    msg.decodedSignals.resize(count);   // Reuses the previous frame's storage
+    std::copy(decoded, decoded + count, msg.decodedSignals.begin());
+    ++msg.count;
+    if (cycleTimeMs >= 0.0)
+        msg.cycleTimeMs = cycleTimeMs;
+
+    for (int i = 0; i < count; ++i)
+        samples.append(SignalSample{decoded[i].index, decoded[i].value, timestampInMs});
+
+    if (timestampInMs > this->timestampInMs)
+        this->timestampInMs = timestampInMs;
+}
+
+void CanUiSnapshot::merge(CanUiSnapshot &other)
+{
+    if (messages.isEmpty() && samples.isEmpty()) {
+        // Common case: nothing pending, just take the other side's containers
+        messages.swap(other.messages);
+        samples.swap(other.samples);
+    } else {
+        for (auto it = other.messages.begin(); it != other.messages.end(); ++it) {
+            auto mine = messages.find(it.key());
+            if (mine == messages.end()) {
+                messages.insert(it.key(), it.value());
+                continue;
+            }
+            mine->frame = it->frame;
+            mine->decodedSignals = it->decodedSignals;
+            mine->count += it->count;
+            if (it->cycleTimeMs >= 0.0)
+                mine->cycleTimeMs = it->cycleTimeMs;
+        }
+        samples.append(other.samples);
+    }
+
+    traceFrames.append(other.traceFrames);
+    if (other.timestampInMs > timestampInMs)
+        timestampInMs = other.timestampInMs;
+
+    other = CanUiSnapshot();
+}
@@ -0,0 +1,41 @@
+#ifndef CANUISNAPSHOT_H
+#define CANUISNAPSHOT_H
+
+#include <CanFrame.h>
+#include <CanDbc.h>
+
+#include <QHash>
+#include <QVector>
+
+// Everything decoded since the last display tick
+struct CanUiSnapshot
+{
+    struct Message {
+        CanFrame frame;                                 // Latest frame of this ID
+        QVector<CanDBC::DecodedSignal> decodedSignals;  // Signals of the latest frame
+        int count = 0;                                  // Frames of this ID in the snapshot
+        double cycleTimeMs = -1.0;                      // Gap between the last two frames, -1 if unknown
+    };
+
+    struct SignalSample {
+        int handle;                                     // CanDBC signal handle
+        double value;
+        qint64 timestampInMs;
+    };
+
+    QHash<uint32_t, Message> messages;              // Latest values per signal live in decodedSignals
+    QVector<SignalSample> samples;                  // Every decoded value in arrival order, for the chart
+    QVector<CanFrame> traceFrames;                  // Every frame, for the trace file
+    qint64 timestampInMs = 0;                       // Time of the newest frame
+
+    bool isEmpty() const { return messages.isEmpty() && traceFrames.isEmpty(); }
+
+    /// Fold one decoded frame in. Frames of one ID must arrive in order.
+    void add(const CanFrame &frame, const CanDBC::DecodedSignal *decoded, int count,
+             qint64 timestampInMs, double cycleTimeMs);
+
+    /// Fold a newer snapshot in and leave it empty.
+    void merge(CanUiSnapshot &other);
+};
+
+#endif // CANUISNAPSHOT_H
@@ -1,6 +1,10 @@
 #include "deviceDialog.h"
 #include "ui_deviceDialog.h"
 
+#ifdef DASHCAN_HAVE_SOCKETCAN
+#include <net/if.h>
+#endif
+
 extern CanApp myApp;
 
 deviceDialog::deviceDialog(QWidget *parent)
@@ -94,6 +98,18 @@ void deviceDialog::loadConfiguration(const TPCANHandle &handle, const TPCANBaudr
 
 void deviceDialog::on_pushButtonDeviceDetect_clicked()
 {
+#ifdef DASHCAN_HAVE_SOCKETCAN
+    if (myApp.h.backend == CanDriver::Backend::SocketCan) {
+        // SocketCAN interfaces are network devices; check the configured one exists
+        if (if_nametoindex(myApp.h.ifName.toLocal8Bit().constData()) == 0) {
+            QMessageBox::warning(this, "Auto Detect", QString("SocketCAN interface %1 not found.").arg(myApp.h.ifName));
+            return;
+        }
+        QMessageBox::information(this, "Auto Detect", QString("SocketCAN interface %1 detected successfully.").arg(myApp.h.ifName));
+        return;
+    }
+#endif
+#ifdef DASHCAN_HAVE_PCAN
     // Attempt to detect connected PCAN USB devices
     TPCANStatus status = CAN_Initialize(PCAN_NONEBUS, PCAN_BAUD_500K);
     if (status == PCAN_ERROR_INITIALIZE) {
@@ -102,6 +118,7 @@ void deviceDialog::on_pushButtonDeviceDetect_clicked()
     }
     QMessageBox::information(this, "Auto Detect", "PCAN device detected successfully.");
     CAN_Uninitialize(PCAN_NONEBUS);
+#endif
 }
 
 void deviceDialog::on_pushButtonDeviceConfigure_clicked()
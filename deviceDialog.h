@@ -4,7 +4,7 @@
 #pragma once
 
 #include <QDialog>
-#include "canapp.h"
+#include <CanApp.h>
 
 namespace Ui {
 class deviceDialog;
@@ -80,12 +80,10 @@ void MainWindow::resetPlotChart()
     if (myApp.v.chartUpdateTimer)
         myApp.v.chartUpdateTimer->stop();
 
-    // === Remove Series from Chart ===
-    for (auto series : std::as_const(myApp.v.seriesMap)) {
-        myApp.v.chart->removeSeries(series);
-        delete series;
-    }
-    myApp.v.seriesMap.clear();
+    // === Clear Series ===
+    // Series stay on the chart so the handle-indexed stores keep pointing at them
+    for (auto series : std::as_const(myApp.v.seriesMap))
+        series->clear();
 }
 
 void MainWindow::repositionPanelWidgets()
@@ -104,22 +102,71 @@ void MainWindow::repositionPanelWidgets()
     }
 }
 
+void MainWindow::bindSignalHandles()
+{
+    // Resolve the names held by the UI to handles once, so the live path
+    // only ever indexes flat vectors
+    const int count = myDBC.signalCount();
+    const double never = std::numeric_limits<double>::quiet_NaN();
+
+    myApp.v.seriesByHandle.fill(nullptr, count);
+    for (auto it = myApp.v.seriesMap.constBegin(); it != myApp.v.seriesMap.constEnd(); ++it) {
+        const int handle = myDBC.signalHandle(it.key());
+        if (handle >= 0)
+            myApp.v.seriesByHandle[handle] = it.value();
+    }
+
+    myApp.v.signalWidgetByHandle.fill(nullptr, count);
+    for (auto it = myApp.v.signalWidgetMap.constBegin(); it != myApp.v.signalWidgetMap.constEnd(); ++it) {
+        const int handle = myDBC.signalHandle(it.key());
+        if (handle >= 0)
+            myApp.v.signalWidgetByHandle[handle] = it.value();
+    }
+
+    myApp.v.liveDataSignalItems.fill(nullptr, count);
+    myApp.v.liveDataMessageItems.fill(nullptr, myDBC.messageCount());
+    for (int i = 0; i < ui->treeWidgetCanMessage->topLevelItemCount(); ++i) {
+        auto *top = ui->treeWidgetCanMessage->topLevelItem(i);
+        bool ok = false;
+        const int msgIndex = myDBC.messageIndex(top->text(1).toInt(&ok, 16));
+        if (!ok || msgIndex < 0)
+            continue;
+        myApp.v.liveDataMessageItems[msgIndex] = top;
+        for (int ci = 0; ci < top->childCount(); ++ci) {
+            const int handle = myDBC.signalHandle(top->child(ci)->text(0));
+            if (handle >= 0)
+                myApp.v.liveDataSignalItems[handle] = top->child(ci);
+        }
+    }
+
+    {
+        QMutexLocker locker(&myApp.v.bufferMutex);
+        myApp.v.bufferedPoints.clear();
+        myApp.v.bufferedPoints.resize(count);
+    }
+    {
+        QMutexLocker locker(&myApp.v.uiUpdateBufferMutex);
+        myApp.v.lastSignalUIValues.fill(never, count);
+        myApp.v.lastSignalUITimestamps.fill(0, count);
+    }
+    myApp.v.lastSignalValues.fill(never, count);
+}
+
 void MainWindow::onChartUpdateTimer()
 {
     if (!myApp.s.rxRunning && !myApp.s.trcRunning)
         return;
 
-    QMap<QString, QVector<QPointF>> localCopy;
+    QVector<QVector<QPointF>> localCopy;
     {
         QMutexLocker locker(&myApp.v.bufferMutex);
-        localCopy = myApp.v.bufferedPoints;
-        myApp.v.bufferedPoints.clear();
+        localCopy.resize(myApp.v.bufferedPoints.size());
+        localCopy.swap(myApp.v.bufferedPoints);
     }
 
     if (!myApp.v.chart || !myApp.v.axisX)
         return;
 
-    QChart *chart = myApp.v.chart;
     const qint64 timeWindowMs = 30 * 1000;
 
     qint64 latestTimestamp = 0;
@@ -134,33 +181,16 @@ void MainWindow::onChartUpdateTimer()
         return;
     }
 
-    for (auto it = localCopy.constBegin(); it != localCopy.constEnd(); ++it) {
-        const QString &sig = it.key();
-        const QVector<QPointF> &newPoints = it.value();
-
+    for (int handle = 0; handle < localCopy.size(); ++handle) {
+        const QVector<QPointF> &newPoints = constLocalCopy[handle];
         if (newPoints.isEmpty())
             continue;
 
-        // Create and configure series if it doesn't exist
-        if (!myApp.v.seriesMap.contains(sig)) {
-            QLineSeries *newSeries = new QLineSeries();
-            newSeries->setName(sig);
-            chart->addSeries(newSeries);
-
-            if (!newSeries->attachedAxes().contains(myApp.v.axisX))
-                newSeries->attachAxis(myApp.v.axisX);
-
-            if (myApp.v.axisYMap.contains(sig)) {
-                QValueAxis *yAxis = myApp.v.axisYMap[sig];
-                if (yAxis && !newSeries->attachedAxes().contains(yAxis)) {
-                    newSeries->attachAxis(yAxis);
-                }
-            }
-
-            myApp.v.seriesMap[sig] = newSeries;
-        }
+        // Only handles with a series are ever buffered
+        QLineSeries *series = myApp.v.seriesByHandle.value(handle, nullptr);
+        if (!series)
+            continue;
 
-        QLineSeries *series = myApp.v.seriesMap[sig];
         QList<QPointF> existingPoints = series->points();
         bool updated = false;
 
@@ -184,98 +214,118 @@ void MainWindow::onChartUpdateTimer()
     myApp.v.axisX->setRange(latest.addMSecs(-timeWindowMs), latest);
 }
 
-void MainWindow::updateCanMessageUI(const CANMessageData &msgData, QMap<QString, qint64> &lastTimestamps, QMap<QString, double> &lastSignalValues)
+void MainWindow::publishCanUiSnapshot(CanUiSnapshot &snapshot)
 {
-    const QString hexId = QString::number(msgData.msg.ID, 16).toUpper();
-    const QList<QPair<QString, double>> &decodedSignals = msgData.decodedSignals;
-    qint64 timestamp;
-    if (myApp.s.trcRunning && !myApp.s.rxRunning) {
-        timestamp = msgData.timestampInMs;
-    } else {
-        timestamp = QDateTime::currentMSecsSinceEpoch();
+    // Keep accumulating while the GUI is still busy with the previous snapshot
+    if (snapshot.isEmpty() || uiSnapshotPending.exchange(true))
+        return;
+
+    QMetaObject::invokeMethod(this, [this, snapshot]() {
+        uiSnapshotPending = false;
+        applyCanUiSnapshot(snapshot);
+    }, Qt::QueuedConnection);
+    snapshot = CanUiSnapshot();
+}
+
+void MainWindow::applyCanUiSnapshot(const CanUiSnapshot &snapshot)
+{
+    if (myApp.s.rxRunning) {
+        if (myApp.s.rxPaused)
+            return;
+
+        updateCanMessageUI(snapshot);
+        subTabRxTxReceive(snapshot);
+        if (myApp.s.trcRecording && myApp.v.traceFile.isOpen()) {
+            for (const CanFrame &frame : snapshot.traceFrames)
+                recordTraceFile(frame);
+        } else if (myApp.v.traceFile.isOpen()) {
+            stopTraceFile();
+        }
+    } else if (myApp.s.trcRunning) {
+        updateCanMessageUI(snapshot);
     }
+}
+
+void MainWindow::updateCanMessageUI(const CanUiSnapshot &snapshot)
+{
+    const qint64 timestamp = snapshot.timestampInMs;
 
     if (!myApp.s.rxPaused && (myApp.s.rxRunning || myApp.s.trcRunning))
     {
-        // === subTabPlot ===
-        QStringList activeSignalNames;
-        for (int i = 0; i < ui->listWidgetCanSignals->count(); ++i)
-            activeSignalNames.append(ui->listWidgetCanSignals->item(i)->text());
+        // Handles are only valid for the plan the snapshot was decoded with;
+        // a DBC re-applied in between just drops out of range here
+        const int handleCount = myApp.v.seriesByHandle.size();
 
+        // === subTabPlot ===
         {
             QMutexLocker locker(&myApp.v.bufferMutex);
-            for (const auto &signal : decodedSignals) {
-                const QString &sigName = signal.first;
-                double value = signal.second;
-                if (activeSignalNames.contains(sigName))
-                    myApp.v.bufferedPoints[sigName].append(QPointF(timestamp, value));
+            for (const CanUiSnapshot::SignalSample &sample : snapshot.samples) {
+                if (sample.handle < handleCount && myApp.v.seriesByHandle[sample.handle])
+                    myApp.v.bufferedPoints[sample.handle].append(QPointF(sample.timestampInMs, sample.value));
             }
         }
 
         // === subTabLiveData ===
-        for (int i = 0; i < ui->treeWidgetCanMessage->topLevelItemCount(); ++i) {
-            auto *it = ui->treeWidgetCanMessage->topLevelItem(i);
-            if (it->text(1) == hexId) {
-                int count = it->text(4).toInt();
-                it->setText(4, QString::number(count + 1));
-
-                if (lastTimestamps.contains(hexId)) {
-                    qint64 cycleTimeMs = timestamp - lastTimestamps[hexId];
-                    it->setText(5, QString::number(static_cast<double>(cycleTimeMs), 'f', 2));
-                }
-                lastTimestamps[hexId] = timestamp;
-
-                for (const auto &p : decodedSignals) {
-                    QString sigName = p.first;
-                    double val = p.second;
-                    QString valText = QString::number(val);
-
-                    for (int ci = 0; ci < it->childCount(); ++ci) {
-                        auto *child = it->child(ci);
-                        if (child->text(0) == sigName) {
-                            bool isChanging = !lastSignalValues.contains(sigName) ||
-                                              !qFuzzyCompare(1.0 + lastSignalValues[sigName], 1.0 + val);
-
-                            child->setBackground(1, isChanging ? QBrush(Qt::yellow) : QBrush(Qt::NoBrush));
-                            child->setForeground(1, isChanging ? QBrush(Qt::black) : QBrush(Qt::NoBrush));
-                            child->setText(1, valText);
-                            lastSignalValues[sigName] = val;
-                            break;
-                        }
-                    }
-                }
-                break;
+        for (auto it = snapshot.messages.constBegin(); it != snapshot.messages.constEnd(); ++it) {
+            const CanUiSnapshot::Message &msg = it.value();
+            QTreeWidgetItem *top = myApp.v.liveDataMessageItems.value(myDBC.messageIndex(static_cast<int>(it.key())), nullptr);
+            if (!top)
+                continue;
+
+            int count = top->text(4).toInt();
+            top->setText(4, QString::number(count + msg.count));
+            if (msg.cycleTimeMs >= 0)
+                top->setText(5, QString::number(msg.cycleTimeMs, 'f', 2));
+
+            for (const auto &p : msg.decodedSignals) {
+                if (p.index >= handleCount)
+                    continue;
+                QTreeWidgetItem *child = myApp.v.liveDataSignalItems[p.index];
+                if (!child)
+                    continue;
+
+                double val = p.value;
+                double &lastVal = myApp.v.lastSignalValues[p.index];
+                bool isChanging = qIsNaN(lastVal) || !qFuzzyCompare(1.0 + lastVal, 1.0 + val);
+
+                child->setBackground(1, isChanging ? QBrush(Qt::yellow) : QBrush(Qt::NoBrush));
+                child->setForeground(1, isChanging ? QBrush(Qt::black) : QBrush(Qt::NoBrush));
+                child->setText(1, QString::number(val));
+                lastVal = val;
             }
         }
 
         // === subTabPanel ===
-        for (const auto &p : decodedSignals) {
-            const QString &sigName = p.first;
-            double val = p.second;
-
-            if (!myApp.v.signalWidgetMap.contains(sigName)) continue;
-
-            const double prevVal = myApp.v.lastSignalUIValues.value(sigName, std::numeric_limits<double>::quiet_NaN());
-            const qint64 lastTs = myApp.v.lastSignalUITimestamps.value(sigName, 0);
-            const bool changed = !qFuzzyCompare(1.0 + val, 1.0 + prevVal);
-            const bool timeout = (timestamp - lastTs) >= 250;
-
-            if (changed || timeout) {
-                QWidget *w = myApp.v.signalWidgetMap[sigName];
-                if (auto *lcd = qobject_cast<QLCDNumber *>(w)) lcd->display(val);
-                else if (auto *bar = qobject_cast<QProgressBar *>(w)) bar->setValue(static_cast<int>(val));
-                else if (auto *slider = qobject_cast<QSlider *>(w)) slider->setValue(static_cast<int>(val));
-                else if (auto *dial = qobject_cast<QDial *>(w)) dial->setValue(static_cast<int>(val));
-                else if (auto *lbl = qobject_cast<QLabel *>(w)) lbl->setText(QString::number(val, 'f', 1));
-                else if (auto *chk = qobject_cast<QCheckBox *>(w)) chk->setChecked(val > 0.5);
-                else if (auto *combo = qobject_cast<QComboBox *>(w)) {
-                    int index = static_cast<int>(val);
-                    if (index >= 0 && index < combo->count())
-                        combo->setCurrentIndex(index);
-                }
+        for (auto it = snapshot.messages.constBegin(); it != snapshot.messages.constEnd(); ++it) {
+            for (const auto &p : it->decodedSignals) {
+                if (p.index >= handleCount)
+                    continue;
+                QWidget *w = myApp.v.signalWidgetByHandle[p.index];
+                if (!w)
+                    continue;
+
+                double val = p.value;
+                const double prevVal = myApp.v.lastSignalUIValues[p.index];
+                const qint64 lastTs = myApp.v.lastSignalUITimestamps[p.index];
+                const bool changed = !qFuzzyCompare(1.0 + val, 1.0 + prevVal);
+                const bool timeout = (timestamp - lastTs) >= 250;
+
+                if (changed || timeout) {
+                    if (auto *lcd = qobject_cast<QLCDNumber *>(w)) lcd->display(val);
+                    else if (auto *bar = qobject_cast<QProgressBar *>(w)) bar->setValue(static_cast<int>(val));
+                    else if (auto *slider = qobject_cast<QSlider *>(w)) slider->setValue(static_cast<int>(val));
+                    else if (auto *dial = qobject_cast<QDial *>(w)) dial->setValue(static_cast<int>(val));
+                    else if (auto *lbl = qobject_cast<QLabel *>(w)) lbl->setText(QString::number(val, 'f', 1));
+                    else if (auto *chk = qobject_cast<QCheckBox *>(w)) chk->setChecked(val > 0.5);
+                    else if (auto *combo = qobject_cast<QComboBox *>(w)) {
+                        int index = static_cast<int>(val);
+                        if (index >= 0 && index < combo->count())
+                            combo->setCurrentIndex(index);
+                    }
 
-                myApp.v.lastSignalUIValues[sigName] = val;
-                myApp.v.lastSignalUITimestamps[sigName] = timestamp;
+                    myApp.v.lastSignalUIValues[p.index] = val;
+                    myApp.v.lastSignalUITimestamps[p.index] = timestamp;
+                }
             }
         }
     }
@@ -347,20 +397,19 @@ void MainWindow::on_pushButtonTxStartStop_clicked()
                     if (dlc <= 0 || dataList.size() > 8)
                         continue;
 
-                    TPCANMsg CANMsg;
-                    CANMsg.ID = msgIdStr.toUInt(nullptr, 16);
-                    CANMsg.LEN = static_cast<BYTE>(dlc);
-                    CANMsg.MSGTYPE = PCAN_MESSAGE_STANDARD;
+                    CanFrame CANMsg{};
+                    CANMsg.id = msgIdStr.toUInt(nullptr, 16);
+                    CANMsg.len = static_cast<uint8_t>(dlc);
 
                     for (int i = 0; i < dataList.size(); ++i) {
                         bool ok = false;
                         uint byteVal = dataList[i].toUInt(&ok, 16);
-                        CANMsg.DATA[i] = ok ? static_cast<BYTE>(byteVal) : 0x00;
+                        CANMsg.data[i] = ok ? static_cast<uint8_t>(byteVal) : 0x00;
                     }
 
                     if(!myApp.s.txPaused)
                     {
-                        TPCANStatus sts = CAN_Write(myApp.h.handle, &CANMsg);
+                        int sts = myApp.DeviceWrite(CANMsg);
                         if (sts == PCAN_ERROR_OK) {
                             quint64 currentCount = 0;
                             if (countItem && !countItem->text().isEmpty()) {
@@ -445,6 +494,14 @@ void MainWindow::on_pushButtonRxStartStop_clicked()
         myApp.DeviceBufferReset();
         resetPlotChart();
 
+        // A finished replay may still own the ring
+        myApp.v.trcRePlayProducerFuture.waitForFinished();
+        myApp.v.trcRePlayCosumerFuture.waitForFinished();
+        canFrameRing.SetOverflowPolicy(rxOverflowPolicy);
+        canFrameRing.Open();
+        decodePool.Start();
+        uiSnapshotPending = false;
+
         myApp.s.trcRunning = false;
         myApp.s.rxPaused = false;
         myApp.s.rxRunning = true;
@@ -461,21 +518,28 @@ void MainWindow::on_pushButtonRxStartStop_clicked()
         ui->pushButtonTraceRePlayPauseResume->setEnabled(false);
 
         myApp.v.RxProducerFuture = QtConcurrent::run([this]() {
+            // Caller-owned batch storage, allocated once per RX session
+            CanFrame batch[RX_BATCH_SIZE];
+
             while (myApp.s.rxRunning)
             {
-                TPCANMsg msg;
-                TPCANTimestamp ts;
-                TPCANStatus sts = CAN_Read(myApp.h.handle, &msg, &ts);
-
-                if (sts == PCAN_ERROR_OK) {
-                    QByteArray canData(reinterpret_cast<char*>(msg.DATA), msg.LEN);
-                    QList<QPair<QString, double>> decodedSignals = myDBC.decodeFrame(msg.ID, canData);
-                    QMutexLocker locker(&queueMutex);
-                    canMessageQueue.enqueue(CANMessageData{msg, ts, decodedSignals});
-                    queueNotEmpty.wakeOne();
+                // Sleep on the driver receive event; the timeout only bounds stop latency
+                int sts = myApp.DeviceWaitForReceive(RX_WAIT_TIMEOUT_MS);
+                if (sts == PCAN_ERROR_QRCVEMPTY)
+                    continue;
+
+                // Drain everything queued since the event fired, one batch at a time
+                int count = 0;
+                while (myApp.s.rxRunning && (sts = myApp.DeviceReadBatch(batch, RX_BATCH_SIZE, count)) == PCAN_ERROR_OK) {
+                    // Raw frames only; decoding happens on the consumer side
+                    canFrameRing.PushBatch(batch, static_cast<size_t>(count));
+
+                    if (count < RX_BATCH_SIZE)
+                        break;
                 }
-                else if (sts == PCAN_ERROR_QRCVEMPTY) {
-                    QThread::msleep(1);
+
+                if (sts == PCAN_ERROR_OK || sts == PCAN_ERROR_QRCVEMPTY) {
+                    // Queue drained
                 }
                 else if (sts == PCAN_ERROR_QOVERRUN) {
                     qWarning() << "⚠️ CAN queue overrun: messages lost!";
@@ -486,43 +550,33 @@ void MainWindow::on_pushButtonRxStartStop_clicked()
                     QThread::msleep(2);
                 }
             }
-            queueNotEmpty.wakeAll();
         });
 
         consumerThreadRunning = true;
         myApp.v.RxConsumerFuture = QtConcurrent::run([this]() {
-            QMap<QString, qint64> lastTimestamps;
-            QMap<QString, double> lastSignalValues;
+            CanUiSnapshot snapshot;
+            QElapsedTimer uiTick;
+            uiTick.start();
+            CanFrame frames[RX_BATCH_SIZE];
             while (consumerThreadRunning)
             {
-                queueMutex.lock();
-                if (canMessageQueue.isEmpty() && consumerThreadRunning) {
-                    queueNotEmpty.wait(&queueMutex, 1000);
-                }
-
-                if (!consumerThreadRunning) {
-                    queueMutex.unlock();
-                    break;
+                // Dispatch raw frames to the decode workers; trace order is kept here
+                if (canFrameRing.WaitForData(UI_SNAPSHOT_INTERVAL_MS)) {
+                    const bool recordTrace = myApp.s.trcRecording;
+                    const qint64 nowMs = QDateTime::currentMSecsSinceEpoch();
+                    size_t count = canFrameRing.PopBatch(frames, RX_BATCH_SIZE);
+                    for (size_t i = 0; i < count; ++i) {
+                        decodePool.Submit(frames[i], nowMs);
+                        if (recordTrace)
+                            snapshot.traceFrames.append(frames[i]);
+                    }
                 }
 
-                if (!canMessageQueue.isEmpty()) {
-                    CANMessageData msgData = canMessageQueue.dequeue();
-                    queueMutex.unlock();
-
-                    QMetaObject::invokeMethod(this, [=, &lastTimestamps, &lastSignalValues]() mutable {
-                        if (!myApp.s.rxPaused && myApp.s.rxRunning)
-                        {
-                            updateCanMessageUI(msgData, lastTimestamps, lastSignalValues);
-                            subTabRxTxReceive(msgData.msg);
-                            if (myApp.s.trcRecording && myApp.v.traceFile.isOpen()) {
-                                recordTraceFile(msgData.msg, msgData.ts);
-                            } else if (myApp.v.traceFile.isOpen()) {
-                                stopTraceFile();
-                            }
-                        }
-                    }, Qt::QueuedConnection);
-                } else {
-                    queueMutex.unlock();
+                // One queued GUI update per display tick, however many frames arrived
+                if (uiTick.elapsed() >= UI_SNAPSHOT_INTERVAL_MS) {
+                    decodePool.Collect(snapshot);
+                    publishCanUiSnapshot(snapshot);
+                    uiTick.restart();
                 }
             }
 
@@ -539,17 +593,19 @@ void MainWindow::on_pushButtonRxStartStop_clicked()
     {
         myApp.s.rxRunning = false;
         consumerThreadRunning = false;
-        queueNotEmpty.wakeAll();
+        canFrameRing.Close();
 
         myApp.v.RxProducerFuture.waitForFinished();
         myApp.v.RxConsumerFuture.waitForFinished();
+        decodePool.Stop();
 
         for (int i = 0; i < ui->treeWidgetCanMessage->topLevelItemCount(); ++i) {
             QTreeWidgetItem *item = ui->treeWidgetCanMessage->topLevelItem(i);
             if (item) item->setText(4, QString::number(0));
         }
 
-        myApp.v.bufferedPoints.clear();
+        for (auto &points : myApp.v.bufferedPoints)
+            points.clear();
         myApp.v.chartUpdateTimer->stop();
         if (myApp.v.axisX) {
             QDateTime now = QDateTime::currentDateTime();
@@ -641,11 +697,12 @@ void MainWindow::on_pushButtonApplyDbc_clicked()
         return;
     }
 
-    // Parse into messageDefinitions
+    // Parse into messageDefinitions and the decode plan
     if (!myDBC.loadDBC(myApp.v.dbcFilePath)) {
         QMessageBox::warning(this, tr("Error"), tr("Failed to load DBC file"));
         return;
     }
+    bindSignalHandles();
 
     // Prepare the tree
     ui->treeWidgetCanMessageList->clear();
@@ -796,14 +853,12 @@ void MainWindow::on_pushButtonAddItem_clicked()
         }
 
         // find definition
-        const auto &msgs = myDBC.msgList();
-        auto it = std::find_if(msgs.cbegin(), msgs.cend(),
-                               [&](auto const &mm){ return mm.id == msgId && mm.name == msgName; });
-        if (it == msgs.cend()) {
+        const CanDBC::Message *def = myDBC.messageDef(msgId);
+        if (!def || def->name != msgName) {
             QMessageBox::warning(this, tr("Error"), tr("Message not found."));
             return;
         }
-        const auto &msg = *it;
+        const auto &msg = *def;
 
         // add to tree
         QStringList cols{msg.name, hexId, msg.description, msg.sender, QString::number(0), QString("-")};
@@ -877,16 +932,8 @@ void MainWindow::on_pushButtonAddItem_clicked()
                 series->attachAxis(myApp.v.axisX);
             }
 
-            QString unit;
-            for (const auto &msg : myDBC.msgList()) {
-                for (const auto &sig : msg.canSignals) {
-                    if (sig.name == signalName) {
-                        unit = sig.unit;
-                        break;
-                    }
-                }
-                if (!unit.isEmpty()) break;
-            }
+            const CanDBC::Signal *sigDef = myDBC.signalDef(signalName);
+            const QString unit = sigDef ? sigDef->unit : QString();
 
             // Create a new Y-axis for this signal
             auto *yAxis = new QValueAxis();
@@ -1001,6 +1048,7 @@ void MainWindow::on_pushButtonAddItem_clicked()
             container->deleteLater();
             myApp.v.signalWidgetMap.remove(signalName);
             myApp.v.signalContainers.removeAll(container);
+            bindSignalHandles();
             repositionPanelWidgets();
         });
 
@@ -1090,7 +1138,10 @@ void MainWindow::on_pushButtonAddItem_clicked()
     else
     {
         QMessageBox::warning(this, tr("Warning"), tr("Adding is only supported in Live Data/Plot/Panel/Rx-Tx tab!"));
+        return;
     }
+
+    bindSignalHandles();
 }
 
 void MainWindow::on_pushButtonRemoveItem_clicked()
@@ -1153,9 +1204,6 @@ void MainWindow::on_pushButtonRemoveItem_clicked()
                 }
             }
 
-            // Remove signal from any data buffers too
-            myApp.v.bufferedPoints.remove(sigName);
-
             // Finally, remove from list widget
             delete ui->listWidgetCanSignals->takeItem(ui->listWidgetCanSignals->row(listItem));
         }
@@ -1171,6 +1219,9 @@ void MainWindow::on_pushButtonRemoveItem_clicked()
             QMessageBox::warning(this, "Remove Item", "Please select a row to remove.");
         }
     }
+
+    // Drop the removed signals from the handle-indexed stores and their buffers
+    bindSignalHandles();
 }
 
 void MainWindow::on_tableWidgetTx_cellDoubleClicked(int row, int column)
@@ -1351,10 +1402,9 @@ void MainWindow::on_tableWidgetTx_cellDoubleClicked(int row, int column)
             }
         }
 
-        TPCANMsg txMsg;
-        txMsg.ID = msgIdStr.toUInt(nullptr, 16);
-        txMsg.LEN = static_cast<BYTE>(dlc);
-        txMsg.MSGTYPE = PCAN_MESSAGE_STANDARD;
+        CanFrame txMsg{};
+        txMsg.id = msgIdStr.toUInt(nullptr, 16);
+        txMsg.len = static_cast<uint8_t>(dlc);
 
         for (int i = 0; i < dataList.size(); ++i) {
             bool ok;
@@ -1363,10 +1413,10 @@ void MainWindow::on_tableWidgetTx_cellDoubleClicked(int row, int column)
                 QMessageBox::warning(this, "Invalid Data", "Invalid byte: " + dataList[i]);
                 return;
             }
-            txMsg.DATA[i] = static_cast<BYTE>(byteVal);
+            txMsg.data[i] = static_cast<uint8_t>(byteVal);
         }
 
-        TPCANStatus status = CAN_Write(myApp.h.handle, &txMsg);
+        int status = myApp.DeviceWrite(txMsg);
         if (status == PCAN_ERROR_OK) {
             QTableWidgetItem *countItem = ui->tableWidgetTx->item(row, 3);
             quint64 currentCount = 0;
@@ -1461,14 +1511,11 @@ void MainWindow::startTraceFile()
     }
 }
 
-void MainWindow::recordTraceFile(const TPCANMsg &msg, const TPCANTimestamp &ts)
+void MainWindow::recordTraceFile(const CanFrame &frame)
 {
     if (!myApp.v.traceFile.isOpen()) return;
 
-    // Convert timestamp to microseconds
-    quint64 timestamp_us = ts.micros +
-                           (1000ULL * ts.millis) +
-                           (0x100000000ULL * 1000ULL * ts.millis_overflow);
+    quint64 timestamp_us = frame.timestampUs;
 
     // Set traceStartTime on first message
     if (myApp.v.traceMsgCounter == 0) {
@@ -1482,11 +1529,11 @@ void MainWindow::recordTraceFile(const TPCANMsg &msg, const TPCANTimestamp &ts)
     stream << QString(" %1    %2 DT 1      %3 Rx - %4    ")
                   .arg(myApp.v.traceMsgCounter, 7)
                   .arg(offset_ms, 10, 'f', 3)
-                  .arg(msg.ID, 4, 16, QLatin1Char('0')).toUpper()
-                  .arg(msg.LEN, 2);
+                  .arg(frame.id, 4, 16, QLatin1Char('0')).toUpper()
+                  .arg(frame.len, 2);
 
-    for (int i = 0; i < msg.LEN; ++i) {
-        stream << QString("%1 ").arg(msg.DATA[i], 2, 16, QLatin1Char('0')).toUpper();
+    for (int i = 0; i < frame.len; ++i) {
+        stream << QString("%1 ").arg(frame.data[i], 2, 16, QLatin1Char('0')).toUpper();
     }
 
     stream << "\n";
@@ -1583,50 +1630,44 @@ void MainWindow::readTraceFileAndPopulate()
     myApp.s.trcFileLoaded = true;
 }
 
-void MainWindow::subTabRxTxReceive(const TPCANMsg &msg)
+void MainWindow::subTabRxTxReceive(const CanUiSnapshot &snapshot)
 {
     QTableWidget *table = ui->tableWidgetRx;
-    uint32_t msgId = msg.ID;
-    qint64 currentTimestamp = QDateTime::currentMSecsSinceEpoch();
 
-    if (myApp.v.msgIdToRowMap.contains(msgId)) {
-        int row = myApp.v.msgIdToRowMap[msgId];
-
-        table->item(row, 1)->setText(QString::number(msg.LEN));
+    for (auto it = snapshot.messages.constBegin(); it != snapshot.messages.constEnd(); ++it) {
+        const uint32_t msgId = it.key();
+        const CanUiSnapshot::Message &msg = it.value();
+        const CanFrame &frame = msg.frame;
 
         QString dataStr;
-        for (int i = 0; i < msg.LEN; ++i) {
-            dataStr += QString("%1 ").arg(msg.DATA[i], 2, 16, QChar('0')).toUpper();
+        for (int i = 0; i < frame.len; ++i) {
+            dataStr += QString("%1 ").arg(frame.data[i], 2, 16, QChar('0')).toUpper();
         }
-        table->item(row, 2)->setText(dataStr.trimmed());
-
-        int count = ++myApp.v.msgIdToCount[msgId];
-        table->item(row, 3)->setText(QString::number(count));
 
-        qint64 lastTime = myApp.v.msgIdToLastTimestamp.value(msgId, currentTimestamp);
-        double cycleTime = static_cast<double>(currentTimestamp - lastTime);
-        table->item(row, 4)->setText(QString("%1").arg(cycleTime, 0, 'f', 2));
+        if (myApp.v.msgIdToRowMap.contains(msgId)) {
+            int row = myApp.v.msgIdToRowMap[msgId];
 
-        myApp.v.msgIdToLastTimestamp[msgId] = currentTimestamp;
-    } else {
-        int newRow = table->rowCount();
-        table->insertRow(newRow);
+            table->item(row, 1)->setText(QString::number(frame.len));
+            table->item(row, 2)->setText(dataStr.trimmed());
 
-        table->setItem(newRow, 0, new QTableWidgetItem(QString("0x%1").arg(msgId, 0, 16).toUpper()));
-        table->setItem(newRow, 1, new QTableWidgetItem(QString::number(msg.LEN)));
+            int count = (myApp.v.msgIdToCount[msgId] += msg.count);
+            table->item(row, 3)->setText(QString::number(count));
 
-        QString dataStr;
-        for (int i = 0; i < msg.LEN; ++i) {
-            dataStr += QString("%1 ").arg(msg.DATA[i], 2, 16, QChar('0')).toUpper();
-        }
-        table->setItem(newRow, 2, new QTableWidgetItem(dataStr.trimmed()));
+            if (msg.cycleTimeMs >= 0)
+                table->item(row, 4)->setText(QString("%1").arg(msg.cycleTimeMs, 0, 'f', 2));
+        } else {
+            int newRow = table->rowCount();
+            table->insertRow(newRow);
 
-        table->setItem(newRow, 3, new QTableWidgetItem("1"));
-        table->setItem(newRow, 4, new QTableWidgetItem("0"));
+            table->setItem(newRow, 0, new QTableWidgetItem(QString("0x%1").arg(msgId, 0, 16).toUpper()));
+            table->setItem(newRow, 1, new QTableWidgetItem(QString::number(frame.len)));
+            table->setItem(newRow, 2, new QTableWidgetItem(dataStr.trimmed()));
+            table->setItem(newRow, 3, new QTableWidgetItem(QString::number(msg.count)));
+            table->setItem(newRow, 4, new QTableWidgetItem(QString("%1").arg(qMax(msg.cycleTimeMs, 0.0), 0, 'f', 2)));
 
-        myApp.v.msgIdToRowMap[msgId] = newRow;
-        myApp.v.msgIdToLastTimestamp[msgId] = currentTimestamp;
-        myApp.v.msgIdToCount[msgId] = 1;
+            myApp.v.msgIdToRowMap[msgId] = newRow;
+            myApp.v.msgIdToCount[msgId] = msg.count;
+        }
     }
 }
 
@@ -1711,6 +1752,14 @@ void MainWindow::on_pushButtonTraceRePlayStartStop_clicked()
         myApp.DeviceBufferReset();
         resetPlotChart();
 
+        // Replay is paced by the trace, so it waits for the decoder instead of dropping
+        myApp.v.trcRePlayProducerFuture.waitForFinished();
+        myApp.v.trcRePlayCosumerFuture.waitForFinished();
+        canFrameRing.SetOverflowPolicy(CanRingBuffer<CanFrame>::OverflowPolicy::Block);
+        canFrameRing.Open();
+        decodePool.Start();
+        uiSnapshotPending = false;
+
         myApp.s.trcRunning = true;
         myApp.s.rxRunning = false;
         myApp.s.txRunning = false;
@@ -1773,34 +1822,23 @@ void MainWindow::on_pushButtonTraceRePlayStartStop_clicked()
                     QThread::usleep(500);
                 }
 
-                TPCANMsg msg;
-                TPCANTimestamp ts = {0};
-                qint64 timestampInMs = currentTraceMs;
-
-                ts.millis = static_cast<DWORD>(currentTraceMs & 0xFFFFFFFF);
-                ts.millis_overflow = static_cast<WORD>((static_cast<quint64>(currentTraceMs) >> 32) & 0xFFFF);
-                ts.micros = 0;
-
-                msg.ID = static_cast<DWORD>(data.traceMsgId);
-                msg.MSGTYPE = (msg.ID > 0x7FF) ? PCAN_MESSAGE_EXTENDED : PCAN_MESSAGE_STANDARD;
-                msg.LEN = static_cast<BYTE>(data.traceMsgDlc);
-                memset(msg.DATA, 0, sizeof(msg.DATA));
-                for (int j = 0; j < msg.LEN && j < 8; ++j) {
-                    msg.DATA[j] = static_cast<BYTE>(data.traceMsgData[j]);
+                CanFrame frame{};
+                frame.timestampUs = static_cast<uint64_t>(currentTraceMs) * 1000ULL;
+                frame.id = static_cast<uint32_t>(data.traceMsgId);
+                frame.flags = (frame.id > 0x7FF) ? CanFrame::Extended : 0;
+                frame.len = static_cast<uint8_t>(data.traceMsgDlc);
+                for (int j = 0; j < frame.len && j < 8; ++j) {
+                    frame.data[j] = static_cast<uint8_t>(data.traceMsgData[j]);
                 }
 
-                TPCANStatus status = CAN_Write(myApp.h.handle, &msg);
+                int status = myApp.DeviceWrite(frame);
                 if (status != PCAN_ERROR_OK) {
                     qWarning() << "CAN_Write failed at index" << i << "Status:" << status;
                     break;
                 }
 
-                QByteArray canData(reinterpret_cast<char*>(msg.DATA), msg.LEN);
-                QList<QPair<QString, double>> decodedSignals = myDBC.decodeFrame(msg.ID, canData);
-
-                QMutexLocker locker(&queueMutex);
-                canMessageQueue.enqueue(CANMessageData{msg, ts, decodedSignals, timestampInMs});
-                queueNotEmpty.wakeOne();
+                if (!canFrameRing.Push(frame))
+                    break;
 
                 // Highlight current trace row
                 QMetaObject::invokeMethod(this, [this, i]() {
@@ -1816,31 +1854,29 @@ void MainWindow::on_pushButtonTraceRePlayStartStop_clicked()
             myApp.s.trcRunning = false;
             myApp.s.trcPaused = false;
             consumerThreadRunning = false;
-            queueNotEmpty.wakeAll();
+            canFrameRing.Close();
         });
 
         // === Consumer Thread ===
         consumerThreadRunning = true;
         myApp.v.trcRePlayCosumerFuture = QtConcurrent::run([this]() {
-            QMap<QString, qint64> lastTimestamps;
-            QMap<QString, double> lastSignalValues;
+            CanUiSnapshot snapshot;
+            QElapsedTimer uiTick;
+            uiTick.start();
+            CanFrame frames[RX_BATCH_SIZE];
 
             while (consumerThreadRunning) {
-                queueMutex.lock();
-                while (canMessageQueue.isEmpty() && consumerThreadRunning)
-                    queueNotEmpty.wait(&queueMutex);
-
-                if (!consumerThreadRunning) {
-                    queueMutex.unlock();
-                    break;
+                if (canFrameRing.WaitForData(UI_SNAPSHOT_INTERVAL_MS)) {
+                    size_t count = canFrameRing.PopBatch(frames, RX_BATCH_SIZE);
+                    for (size_t i = 0; i < count; ++i)
+                        decodePool.Submit(frames[i], static_cast<qint64>(frames[i].timestampUs / 1000ULL));
                 }
 
-                CANMessageData msgData = canMessageQueue.dequeue();
-                queueMutex.unlock();
-
-                QMetaObject::invokeMethod(this, [=, &lastTimestamps, &lastSignalValues]() mutable {
-                    updateCanMessageUI(msgData, lastTimestamps, lastSignalValues);
-                }, Qt::QueuedConnection);
+                if (uiTick.elapsed() >= UI_SNAPSHOT_INTERVAL_MS) {
+                    decodePool.Collect(snapshot);
+                    publishCanUiSnapshot(snapshot);
+                    uiTick.restart();
+                }
             }
 
             QMetaObject::invokeMethod(this, [this]() {
@@ -1871,6 +1907,7 @@ void MainWindow::on_pushButtonTraceRePlayStartStop_clicked()
         consumerThreadRunning = false;
         myApp.s.trcRunning = false;
         myApp.s.trcPaused = false;
+        canFrameRing.Close();
 
         ui->pushButtonRxStartStop->setEnabled(true);
         ui->pushButtonTxStartStop->setEnabled(true);
@@ -1892,7 +1929,8 @@ void MainWindow::on_pushButtonTraceRePlayStartStop_clicked()
             if (item) item->setText(4, QString::number(0));
         }
 
-        myApp.v.bufferedPoints.clear();
+        for (auto &points : myApp.v.bufferedPoints)
+            points.clear();
         myApp.v.chartUpdateTimer->stop();
 
         if (myApp.v.axisX) {
@@ -1975,8 +2013,13 @@ void MainWindow::on_pushButtonDeviceConnectDisconnect_clicked()
         {
             myApp.s.deviceConnected = true;
 
-            ui->labelDeviceName->setText(dlg.getPcanDeviceName(myApp.h.handle));
-            ui->labelDeviceBitRate->setText(dlg.getPcanBitrateString(myApp.h.bitRate));
+            if (myApp.h.backend == CanDriver::Backend::SocketCan) {
+                ui->labelDeviceName->setText(myApp.driver->Name());
+                ui->labelDeviceBitRate->setText(tr("Set by interface"));
+            } else {
+                ui->labelDeviceName->setText(dlg.getPcanDeviceName(myApp.h.handle));
+                ui->labelDeviceBitRate->setText(dlg.getPcanBitrateString(myApp.h.bitRate));
+            }
             ui->labelConnectionStatus->setText("Connected");
             ui->labelConnectionStatus->setStyleSheet(
                 R"(QLabel {background-color: #22C55E; color: #FFFFFF})");
@@ -1994,8 +2037,21 @@ void MainWindow::on_pushButtonDeviceConnectDisconnect_clicked()
             if (!canStatusTimer)
                 canStatusTimer = new QTimer(this);
 
-            connect(canStatusTimer, &QTimer::timeout, this, [this]() {
-                TPCANStatus st = CAN_GetStatus(myApp.h.handle);
+            connect(canStatusTimer, &QTimer::timeout, this, [this, lastRingDrops = uint64_t(0)]() mutable {
+                // RX queue backpressure
+                const uint64_t drops = canFrameRing.DropCount();
+                if (drops < lastRingDrops)
+                    lastRingDrops = 0;      // ring reopened
+                if (drops != lastRingDrops) {
+                    qWarning() << "⚠️ RX queue overflow:" << (drops - lastRingDrops) << "frames dropped!";
+                    lastRingDrops = drops;
+                }
+                ui->labelDeviceBusErrorStatus->setToolTip(
+                    QString("RX queue: %1 / %2 (peak %3), dropped: %4")
+                        .arg(canFrameRing.Size()).arg(canFrameRing.Capacity())
+                        .arg(canFrameRing.HighWatermark()).arg(drops));
+
+                int st = myApp.DeviceGetStatus();
                 if (st == PCAN_ERROR_OK) {
                     ui->labelDeviceBusErrorStatus->setText("Bus OK");
                     ui->labelDeviceBusErrorStatus->setStyleSheet(
@@ -2061,12 +2117,14 @@ void MainWindow::on_pushButtonDeviceConnectDisconnect_clicked()
         myApp.s.txPaused = myApp.s.rxPaused = myApp.s.trcPaused = false;
         consumerThreadRunning = false;
 
-        queueNotEmpty.wakeAll();
+        canFrameRing.Close();
         myApp.v.RxProducerFuture.waitForFinished();
         myApp.v.RxConsumerFuture.waitForFinished();
+        decodePool.Stop();
 
         // === Stop charts and clear data ===
-        myApp.v.bufferedPoints.clear();
+        for (auto &points : myApp.v.bufferedPoints)
+            points.clear();
         if (myApp.v.chartUpdateTimer) {
             myApp.v.chartUpdateTimer->stop();
         }
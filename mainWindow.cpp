@@ -17,6 +17,7 @@ MainWindow::MainWindow(const QString &workspacePath, QWidget *parent)
     : QMainWindow(parent)
     , ui(new Ui::MainWindow)
     , workspacePath(workspacePath)
+    , decodePool(myDBC)
 {
     ui->setupUi(this);
     if (!instance) {
@@ -36,13 +37,12 @@ MainWindow::MainWindow(const QString &workspacePath, QWidget *parent)
         QMutexLocker locker(&myApp.v.uiUpdateBufferMutex);
         qint64 now = QDateTime::currentMSecsSinceEpoch();
 
-        for (auto it = myApp.v.lastSignalUIValues.begin(); it != myApp.v.lastSignalUIValues.end(); ++it) {
-            const QString &sigName = it.key();
-            double val = it.value();
-
-            if (myApp.v.signalWidgetMap.contains(sigName)) {
-                QWidget *w = myApp.v.signalWidgetMap[sigName];
+        const int count = qMin(myApp.v.lastSignalUIValues.size(), myApp.v.signalWidgetByHandle.size());
+        for (int handle = 0; handle < count; ++handle) {
+            double val = myApp.v.lastSignalUIValues[handle];
+            QWidget *w = myApp.v.signalWidgetByHandle[handle];
 
+            if (w && !qIsNaN(val)) {
                 if (auto *lcd = qobject_cast<QLCDNumber *>(w)) lcd->display(val);
                 else if (auto *bar = qobject_cast<QProgressBar *>(w)) bar->setValue(static_cast<int>(val));
                 else if (auto *slider = qobject_cast<QSlider *>(w)) slider->setValue(static_cast<int>(val));
@@ -55,8 +55,7 @@ MainWindow::MainWindow(const QString &workspacePath, QWidget *parent)
                         combo->setCurrentIndex(index);
                 }
 
-                myApp.v.lastSignalUIValues[sigName] = val;
-                myApp.v.lastSignalUITimestamps[sigName] = now;
+                myApp.v.lastSignalUITimestamps[handle] = now;
             }
         }
     });
@@ -419,7 +418,7 @@ void MainWindow::closeEvent(QCloseEvent *event)
     // terminate reader/consumer if still running
     if (consumerThreadRunning) {
         consumerThreadRunning = false;
-        queueNotEmpty.wakeAll();
+        canFrameRing.Close();
     }
     saveAppData(workspacePath + "/" + APP_WORKSPACE_FILE_NAME);
     QMainWindow::closeEvent(event);
@@ -475,17 +474,8 @@ void MainWindow::saveAppData(const QString &filePath)
         sigObj["name"] = signalName;
 
         // lookup signal unit
-        QString signalUnit;
-        for (const auto &msg : myDBC.msgList()) {
-            for (const auto &sig : msg.canSignals) {
-                if (sig.name == signalName) {
-                    signalUnit = sig.unit;
-                    break;
-                }
-            }
-            if (!signalUnit.isEmpty()) break;
-        }
-        sigObj["unit"] = signalUnit;
+        const CanDBC::Signal *sigDef = myDBC.signalDef(signalName);
+        sigObj["unit"] = sigDef ? sigDef->unit : QString();
 
         // axis range
         if (myApp.v.axisYMap.contains(signalName)) {
@@ -528,6 +518,10 @@ void MainWindow::saveAppData(const QString &filePath)
     QJsonObject root;
     root["deviceHandle"]    = QString("0x%1").arg(myApp.h.handle, 0, 16).toUpper();
     root["deviceBitrate"]   = QString("0x%1").arg(myApp.h.bitRate, 0, 16).toUpper();
+    root["deviceBackend"]   = (myApp.h.backend == CanDriver::Backend::SocketCan) ? "SocketCAN" : "PCAN";
+    root["deviceInterface"] = myApp.h.ifName;
+    root["rxQueueOverflow"] = (rxOverflowPolicy == CanRingBuffer<CanFrame>::OverflowPolicy::DropNewest) ? "DropNewest" :
+                              (rxOverflowPolicy == CanRingBuffer<CanFrame>::OverflowPolicy::Block)      ? "Block" : "DropOldest";
     root["dbcFilePath"]     = ui->lineEditDbcFileUpload->text();
     root["trcFilePath"]     = ui->lineEditTraceFileUpload->text();
     root["liveDataMessages"]= liveDataMessages;
@@ -628,6 +622,22 @@ void MainWindow::loadAppData(const QString &filePath)
         bool ok = false;
         myApp.h.bitRate = static_cast<TPCANBaudrate>(bitrateStr.toUInt(&ok, 16));
     }
+    if (root.contains("deviceBackend"))
+    {
+        myApp.h.backend = (root["deviceBackend"].toString() == "SocketCAN") ? CanDriver::Backend::SocketCan
+                                                                            : CanDriver::Backend::Pcan;
+    }
+    if (root.contains("deviceInterface"))
+    {
+        myApp.h.ifName = root["deviceInterface"].toString();
+    }
+    if (root.contains("rxQueueOverflow"))
+    {
+        const QString policy = root["rxQueueOverflow"].toString();
+        rxOverflowPolicy = (policy == "DropNewest") ? CanRingBuffer<CanFrame>::OverflowPolicy::DropNewest :
+                           (policy == "Block")      ? CanRingBuffer<CanFrame>::OverflowPolicy::Block
+                                                    : CanRingBuffer<CanFrame>::OverflowPolicy::DropOldest;
+    }
 
     // dbcFilePath
     if (root.contains("dbcFilePath")) {
@@ -790,6 +800,7 @@ void MainWindow::loadAppData(const QString &filePath)
             container->deleteLater();
             myApp.v.signalContainers.removeAll(container);
             myApp.v.signalWidgetMap.remove(sigName);
+            bindSignalHandles();
         });
 
         auto *label = new QLabel(sigName);
@@ -818,6 +829,9 @@ void MainWindow::loadAppData(const QString &filePath)
         myApp.v.signalContainers.append(container);
         myApp.v.signalWidgetMap.insert(sigName, widget);
     }
+
+    // Nothing resolves until a DBC is applied; the apply binds again
+    bindSignalHandles();
 }
 
 void MainWindow::on_pushButtonClearLog_clicked()
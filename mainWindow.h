@@ -3,6 +3,8 @@
 
 #include <QMainWindow>
 #include <CanApp.h>
+#include <CanRingBuffer.h>
+#include <CanDecodePool.h>
 
 // User information JSON file (stored in Roaming or user config)
 #define APP_USER_INFO_FILE_NAME   "DashCAN-user-info.json"
@@ -10,6 +12,18 @@
 // Application JSON data file (workspace-specific)
 #define APP_WORKSPACE_FILE_NAME   "DashCAN-workspace-data.json"
 
+// Upper bound on how long the RX producer sleeps on the receive event
+#define RX_WAIT_TIMEOUT_MS        100
+
+// Frames pulled from the driver per batch read
+#define RX_BATCH_SIZE             256
+
+// Raw frames buffered between acquisition and decoding (rounded up to a power of two)
+#define RX_RING_CAPACITY          65536
+
+// Decoded results are handed to the GUI at most once per display tick (~30 Hz)
+#define UI_SNAPSHOT_INTERVAL_MS   33
+
 QT_BEGIN_NAMESPACE
 namespace Ui {
 class MainWindow;
@@ -28,15 +42,17 @@ public:
     void setupPlotChart(void);
     void resetPlotChart();
     void repositionPanelWidgets();
+    void bindSignalHandles();
     void onChartUpdateTimer();
     bool eventFilter(QObject *obj, QEvent *ev) override;
 
     void startTraceFile();
-    void recordTraceFile(const TPCANMsg &msg, const TPCANTimestamp &ts);
+    void recordTraceFile(const CanFrame &frame);
     void stopTraceFile();
     void readTraceFileAndPopulate();
-    void subTabRxTxReceive(const TPCANMsg &msg);
-    void updateCanMessageUI(const CANMessageData &msgData, QMap<QString, qint64> &lastTimestamps, QMap<QString, double> &lastSignalValues);
+    void subTabRxTxReceive(const CanUiSnapshot &snapshot);
+    void updateCanMessageUI(const CanUiSnapshot &snapshot);
+    void applyCanUiSnapshot(const CanUiSnapshot &snapshot);
 
 private slots:
     void on_pushButtonClearLog_clicked();
@@ -74,10 +90,13 @@ private:
     QString workspacePath;
     QString currentHoveredSignal;
     QMutex threadMutex;
-    QMutex queueMutex;
-    QWaitCondition queueNotEmpty;
-    QQueue<CANMessageData> canMessageQueue;
+    CanRingBuffer<CanFrame> canFrameRing{RX_RING_CAPACITY};
+    CanRingBuffer<CanFrame>::OverflowPolicy rxOverflowPolicy = CanRingBuffer<CanFrame>::OverflowPolicy::DropOldest;
     std::atomic<bool> consumerThreadRunning{false};
+    CanDecodePool decodePool;
+    std::atomic<bool> uiSnapshotPending{false};
+
+    void publishCanUiSnapshot(CanUiSnapshot &snapshot);
 };
 
 #endif // MAINWINDOW_H